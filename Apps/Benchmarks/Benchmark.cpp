@@ -0,0 +1,93 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "Benchmark.h"
+#include "OctaneGUI/Clock.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace Benchmarks
+{
+
+double Measure(int Iterations, const std::function<void()>& Fn)
+{
+    double Result = 0.0;
+    for (int I = 0; I < Iterations; I++)
+    {
+        OctaneGUI::Clock Clock;
+        Fn();
+        const double Elapsed = Clock.Measure() * 1000.0;
+        Result = I == 0 ? Elapsed : std::min<double>(Result, Elapsed);
+    }
+
+    return Result;
+}
+
+int Benchmark::Run(int Argc, char** Argv)
+{
+    std::map<std::string, OnBenchmarkSignature>& Benchmarks = Registry();
+
+    if (Argc <= 1)
+    {
+        for (const std::pair<const std::string, OnBenchmarkSignature>& Item : Benchmarks)
+        {
+            printf("Running benchmark '%s'\n", Item.first.c_str());
+            Item.second();
+        }
+
+        return 0;
+    }
+
+    for (int I = 1; I < Argc; I++)
+    {
+        const auto Iter = Benchmarks.find(Argv[I]);
+        if (Iter == Benchmarks.end())
+        {
+            printf("Failed to find benchmark '%s'.\n", Argv[I]);
+            return -1;
+        }
+
+        printf("Running benchmark '%s'\n", Iter->first.c_str());
+        Iter->second();
+    }
+
+    return 0;
+}
+
+Benchmark::Benchmark(const char* Name, OnBenchmarkSignature&& Fn)
+{
+    Registry()[Name] = std::move(Fn);
+}
+
+std::map<std::string, OnBenchmarkSignature>& Benchmark::Registry()
+{
+    static std::map<std::string, OnBenchmarkSignature> s_Registry;
+    return s_Registry;
+}
+
+}
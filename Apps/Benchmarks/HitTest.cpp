@@ -0,0 +1,159 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "Benchmark.h"
+#include "OctaneGUI/OctaneGUI.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace Benchmarks
+{
+
+static OctaneGUI::Event OnEvent(OctaneGUI::Window*)
+{
+    return OctaneGUI::Event(OctaneGUI::Event::Type::WindowClosed);
+}
+
+static uint32_t OnLoadTexture(const std::vector<uint8_t>&, uint32_t, uint32_t)
+{
+    static uint32_t TextureID = 0;
+    return ++TextureID;
+}
+
+// Visits every child back to front, which is how hit-testing worked before containers kept
+// a grid of their children.
+static std::shared_ptr<OctaneGUI::Control> FindControl(const OctaneGUI::Container& Root, const OctaneGUI::Vector2& Point)
+{
+    for (size_t I = Root.NumControls(); I > 0; I--)
+    {
+        const std::shared_ptr<OctaneGUI::Control>& Item = Root.Get(I - 1);
+        const OctaneGUI::Container* ItemContainer = Item->AsContainer();
+        if (ItemContainer != nullptr)
+        {
+            const std::shared_ptr<OctaneGUI::Control> Result = FindControl(*ItemContainer, Point);
+            if (Result)
+            {
+                return Result;
+            }
+        }
+        else if (Item->Contains(Point))
+        {
+            return Item;
+        }
+    }
+
+    return nullptr;
+}
+
+static void HitTesting()
+{
+    const int Columns = 10;
+    const int Rows = 10000;
+    const int Lookups = 200;
+    const int Iterations = 3;
+
+    OctaneGUI::Application Application;
+    Application
+        .SetOnEvent(OnEvent)
+        .SetOnLoadTexture(OnLoadTexture);
+
+    const char* Json = R"({
+        "Theme": {"FontPath": "Resources/Roboto-Regular.ttf", "FontSize": 18},
+        "Windows": {"Main": {"Title": "Benchmarks", "Width": 1280, "Height": 720}}
+    })";
+
+    std::unordered_map<std::string, OctaneGUI::ControlList> WindowControls;
+    if (!Application.Initialize(Json, WindowControls))
+    {
+        printf("Failed to initialize application.\n");
+        return;
+    }
+
+    // A long table of rows, each holding a row of cells.
+    std::shared_ptr<OctaneGUI::Container> Root = std::make_shared<OctaneGUI::Container>(Application.GetMainWindow().get());
+    for (int Row = 0; Row < Rows; Row++)
+    {
+        const std::shared_ptr<OctaneGUI::Container> RowContainer = Root->AddControl<OctaneGUI::Container>();
+        RowContainer->SetPosition({ 0.0f, (float)Row * 20.0f }).SetSize({ (float)Columns * 50.0f, 20.0f });
+        for (int Column = 0; Column < Columns; Column++)
+        {
+            RowContainer->AddControl<OctaneGUI::Panel>()
+                ->SetPosition({ (float)Column * 50.0f, 0.0f })
+                .SetSize({ 48.0f, 18.0f });
+        }
+    }
+
+    std::vector<OctaneGUI::Vector2> Points(Lookups);
+    for (int I = 0; I < Lookups; I++)
+    {
+        Points[I] = { (float)((I * 37) % (Columns * 50)), (float)((I * 7919) % (Rows * 20)) };
+    }
+
+    std::vector<std::shared_ptr<OctaneGUI::Control>> Expected(Lookups);
+    const double Linear = Measure(Iterations, [&]() -> void
+        {
+            for (int I = 0; I < Lookups; I++)
+            {
+                Expected[I] = FindControl(*Root, Points[I]);
+            }
+        });
+
+    OctaneGUI::Clock Clock;
+    Root->UpdateHitIndex();
+    const double Build = Clock.Measure() * 1000.0;
+
+    bool Matches = true;
+    const double Indexed = Measure(Iterations, [&]() -> void
+        {
+            for (int I = 0; I < Lookups; I++)
+            {
+                Matches = Root->GetControl(Points[I]).lock() == Expected[I] && Matches;
+            }
+        });
+
+    printf("%d lookups in %d controls: linear %.3f ms, indexed %.3f ms (%.2fx), index built in %.3f ms\n",
+        Lookups,
+        Rows * (Columns + 1),
+        Linear,
+        Indexed,
+        Linear / Indexed,
+        Build);
+
+    if (!Matches)
+    {
+        printf("Indexed lookups do not match the linear lookups!\n");
+    }
+
+    Application.Shutdown();
+}
+
+BENCHMARK(HitTest, HitTesting)
+
+}
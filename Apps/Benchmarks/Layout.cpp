@@ -0,0 +1,188 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "Benchmark.h"
+#include "OctaneGUI/OctaneGUI.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace Benchmarks
+{
+
+static OctaneGUI::Event OnEvent(OctaneGUI::Window*)
+{
+    return OctaneGUI::Event(OctaneGUI::Event::Type::WindowClosed);
+}
+
+static uint32_t OnLoadTexture(const std::vector<uint8_t>&, uint32_t, uint32_t)
+{
+    static uint32_t TextureID = 0;
+    return ++TextureID;
+}
+
+// Builds a chain of nested containers where every level also holds a row of fixed size leaves.
+static std::shared_ptr<OctaneGUI::VerticalContainer> BuildTree(OctaneGUI::Window* InWindow, int Depth, int Leaves, std::shared_ptr<OctaneGUI::Control>& Deepest)
+{
+    std::shared_ptr<OctaneGUI::VerticalContainer> Root = std::make_shared<OctaneGUI::VerticalContainer>(InWindow);
+    OctaneGUI::Container* Parent = Root.get();
+    for (int Level = 0; Level < Depth; Level++)
+    {
+        for (int I = 0; I < Leaves; I++)
+        {
+            Deepest = Parent->AddControl<OctaneGUI::Panel>();
+            Deepest->SetSize({ (float)(I % 50), 4.0f });
+        }
+
+        if (Level + 1 < Depth)
+        {
+            Parent = Parent->AddControl<OctaneGUI::VerticalContainer>().get();
+        }
+    }
+
+    return Root;
+}
+
+static void NestedLayout()
+{
+    const int Depth = 20;
+    const int Leaves = 500;
+    const int Iterations = 20;
+
+    OctaneGUI::Application Application;
+    Application
+        .SetOnEvent(OnEvent)
+        .SetOnLoadTexture(OnLoadTexture);
+
+    const char* Json = R"({
+        "Theme": {"FontPath": "Resources/Roboto-Regular.ttf", "FontSize": 18},
+        "Windows": {"Main": {"Title": "Benchmarks", "Width": 1280, "Height": 720}}
+    })";
+
+    std::unordered_map<std::string, OctaneGUI::ControlList> WindowControls;
+    if (!Application.Initialize(Json, WindowControls))
+    {
+        printf("Failed to initialize application.\n");
+        return;
+    }
+
+    // A freshly built tree has nothing cached, which is how every measurement behaved
+    // before container sizes were cached.
+    double Cold = 0.0;
+    OctaneGUI::Vector2 ColdSize;
+    for (int I = 0; I < Iterations; I++)
+    {
+        std::shared_ptr<OctaneGUI::Control> Deepest;
+        std::shared_ptr<OctaneGUI::VerticalContainer> Tree = BuildTree(Application.GetMainWindow().get(), Depth, Leaves, Deepest);
+
+        OctaneGUI::Clock Clock;
+        ColdSize = Tree->CachedDesiredSize();
+        const double Elapsed = Clock.Measure() * 1000.0;
+        Cold = I == 0 ? Elapsed : std::min<double>(Cold, Elapsed);
+    }
+
+    std::shared_ptr<OctaneGUI::Control> Deepest;
+    std::shared_ptr<OctaneGUI::VerticalContainer> Tree = BuildTree(Application.GetMainWindow().get(), Depth, Leaves, Deepest);
+    Tree->CachedDesiredSize();
+
+    // Only the containers between the changed leaf and the root are measured again.
+    OctaneGUI::Vector2 LeafSize;
+    const double Leaf = Measure(Iterations, [&]() -> void
+        {
+            Deepest->Invalidate(OctaneGUI::InvalidateType::Layout);
+            LeafSize = Tree->CachedDesiredSize();
+        });
+
+    const double Warm = Measure(Iterations, [&]() -> void
+        {
+            Tree->CachedDesiredSize();
+        });
+
+    printf("%d controls at depth %d: cold %.3f ms, leaf changed %.3f ms (%.2fx), unchanged %.6f ms\n",
+        Depth * (Leaves + 1),
+        Depth,
+        Cold,
+        Leaf,
+        Cold / Leaf,
+        Warm);
+
+    if (ColdSize != LeafSize)
+    {
+        printf("Cached size does not match the cold size!\n");
+    }
+
+    // A form of rows inside the window. Changing one leaf should only lay out its row.
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    const std::shared_ptr<OctaneGUI::Container> Body = Window->GetContainer();
+    std::shared_ptr<OctaneGUI::Control> FormLeaf;
+    const auto AddForm = [&]() -> std::shared_ptr<OctaneGUI::VerticalContainer>
+    {
+        std::shared_ptr<OctaneGUI::VerticalContainer> Result = Body->AddControl<OctaneGUI::VerticalContainer>();
+        for (int Row = 0; Row < 1000; Row++)
+        {
+            const std::shared_ptr<OctaneGUI::HorizontalContainer> RowContainer = Result->AddControl<OctaneGUI::HorizontalContainer>();
+            for (int Column = 0; Column < 10; Column++)
+            {
+                FormLeaf = RowContainer->AddControl<OctaneGUI::Panel>();
+                FormLeaf->SetSize({ 40.0f, 20.0f });
+            }
+        }
+        return Result;
+    };
+
+    double Full = 0.0;
+    for (int I = 0; I < Iterations; I++)
+    {
+        const std::shared_ptr<OctaneGUI::VerticalContainer> Form = AddForm();
+
+        OctaneGUI::Clock Clock;
+        Window->Update();
+        const double Elapsed = Clock.Measure() * 1000.0;
+        Full = I == 0 ? Elapsed : std::min<double>(Full, Elapsed);
+
+        Body->RemoveControl(Form);
+        Window->Update();
+    }
+
+    AddForm();
+    Window->Update();
+    const double Subtree = Measure(Iterations, [&]() -> void
+        {
+            FormLeaf->Invalidate(OctaneGUI::InvalidateType::Layout);
+            Window->Update();
+        });
+
+    printf("11000 control form: full layout %.3f ms, one leaf changed %.3f ms (%.2fx)\n", Full, Subtree, Full / Subtree);
+
+    Application.Shutdown();
+}
+
+BENCHMARK(Layout, NestedLayout)
+
+}
@@ -0,0 +1,104 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "Benchmark.h"
+#include "OctaneGUI/Rect.h"
+#include "OctaneGUI/VertexBuffer.h"
+
+#include <cstdio>
+#include <vector>
+
+namespace Benchmarks
+{
+
+static void Quads()
+{
+    const size_t Count = 100000;
+    const int Iterations = 50;
+
+    // Lay the glyphs out in lines of 100 like a large text document.
+    std::vector<OctaneGUI::Rect> Rects(Count);
+    std::vector<OctaneGUI::Rect> UVs(Count);
+    std::vector<OctaneGUI::Color> Colors(Count);
+    for (size_t I = 0; I < Count; I++)
+    {
+        const OctaneGUI::Vector2 Position((float)(I % 100) * 9.0f, (float)(I / 100) * 18.0f);
+        Rects[I] = { Position, Position + OctaneGUI::Vector2(8.0f, 16.0f) };
+        UVs[I] = { { (float)(I % 16) / 16.0f, 0.0f }, { (float)(I % 16 + 1) / 16.0f, 1.0f } };
+        Colors[I] = { (uint8_t)I, 255, 255, 255 };
+    }
+
+    // The scalar path is how quads were emitted before the batched kernel.
+    OctaneGUI::VertexBuffer Scalar;
+    const double ScalarTime = Measure(Iterations, [&]() -> void
+        {
+            Scalar.Clear();
+            for (size_t I = 0; I < Count; I++)
+            {
+                const OctaneGUI::Rect& Vertices = Rects[I];
+                const OctaneGUI::Rect& TexCoords = UVs[I];
+                const uint32_t Offset = (uint32_t)I * 4;
+
+                Scalar.AddVertex(Vertices.Min, TexCoords.Min, Colors[I]);
+                Scalar.AddVertex({ Vertices.Max.X, Vertices.Min.Y }, { TexCoords.Max.X, TexCoords.Min.Y }, Colors[I]);
+                Scalar.AddVertex(Vertices.Max, TexCoords.Max, Colors[I]);
+                Scalar.AddVertex({ Vertices.Min.X, Vertices.Max.Y }, { TexCoords.Min.X, TexCoords.Max.Y }, Colors[I]);
+
+                Scalar.AddIndex(Offset);
+                Scalar.AddIndex(Offset + 1);
+                Scalar.AddIndex(Offset + 2);
+                Scalar.AddIndex(Offset);
+                Scalar.AddIndex(Offset + 2);
+                Scalar.AddIndex(Offset + 3);
+            }
+        });
+
+    OctaneGUI::VertexBuffer Batched;
+    const double BatchedTime = Measure(Iterations, [&]() -> void
+        {
+            Batched.Clear();
+            Batched.AddQuads(Rects.data(), UVs.data(), Colors.data(), Count);
+        });
+
+    bool Matches = Scalar.GetIndices() == Batched.GetIndices() && Scalar.GetVertexCount() == Batched.GetVertexCount();
+    for (size_t I = 0; I < Scalar.GetVertices().size() && Matches; I++)
+    {
+        const OctaneGUI::Vertex& A = Scalar.GetVertices()[I];
+        const OctaneGUI::Vertex& B = Batched.GetVertices()[I];
+        Matches = A.Position == B.Position && A.TexCoords == B.TexCoords && A.Col == B.Col;
+    }
+
+    printf("%zu quads: scalar %.3f ms, batched %.3f ms (%.2fx)\n", Count, ScalarTime, BatchedTime, ScalarTime / BatchedTime);
+    if (!Matches)
+    {
+        printf("Batched output does not match the scalar output!\n");
+    }
+}
+
+BENCHMARK(QuadExpansion, Quads)
+
+}
@@ -38,6 +38,81 @@ static void Load(OctaneGUI::Application& Application, const char* JsonControls,
     Utility::Load(Application, JsonControls, List);
 }
 
+class LayoutCounter : public OctaneGUI::VerticalContainer
+{
+public:
+    LayoutCounter(OctaneGUI::Window* InWindow)
+        : OctaneGUI::VerticalContainer(InWindow)
+    {
+    }
+
+    int Layouts { 0 };
+
+protected:
+    virtual void OnLayoutComplete() override
+    {
+        OctaneGUI::VerticalContainer::OnLayoutComplete();
+        Layouts++;
+    }
+};
+
+class MeasureCounter : public OctaneGUI::VerticalContainer
+{
+public:
+    MeasureCounter(OctaneGUI::Window* InWindow)
+        : OctaneGUI::VerticalContainer(InWindow)
+    {
+    }
+
+    virtual OctaneGUI::Vector2 DesiredSize() const override
+    {
+        Measures++;
+        return OctaneGUI::VerticalContainer::DesiredSize();
+    }
+
+    mutable int Measures { 0 };
+};
+
+// Reference hit test that visits every child back to front.
+static std::shared_ptr<OctaneGUI::Control> FindControl(const OctaneGUI::Container& Root, const OctaneGUI::Vector2& Point)
+{
+    for (size_t I = Root.NumControls(); I > 0; I--)
+    {
+        const std::shared_ptr<OctaneGUI::Control>& Item = Root.Get(I - 1);
+        const OctaneGUI::Container* ItemContainer = Item->AsContainer();
+        if (ItemContainer != nullptr)
+        {
+            const std::shared_ptr<OctaneGUI::Control> Result = FindControl(*ItemContainer, Point);
+            if (Result)
+            {
+                return Result;
+            }
+        }
+        else if (Item->Contains(Point))
+        {
+            return Item;
+        }
+    }
+
+    return nullptr;
+}
+
+static bool MatchesReference(const std::shared_ptr<OctaneGUI::Container>& Root)
+{
+    for (float Y = -10.0f; Y < 420.0f; Y += 7.0f)
+    {
+        for (float X = -10.0f; X < 420.0f; X += 7.0f)
+        {
+            if (Root->GetControl({ X, Y }).lock() != FindControl(*Root, { X, Y }))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
 TEST_SUITE(Container,
 
 TEST_CASE(ExpandWidth,
@@ -374,6 +449,261 @@ TEST_CASE(ThemePropertyUpdate,
     return Text->FontSize() == 6.0f && Text->FontSize() != Text->GetTheme()->GetFont()->Size();
 })
 
+TEST_CASE(LayoutRequests,
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "VerticalContainer", "ID": "Container"})", List);
+
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    const std::shared_ptr<LayoutCounter> Root = List.To<OctaneGUI::Container>("Container")->AddControl<LayoutCounter>();
+    std::vector<std::shared_ptr<LayoutCounter>> Leaves;
+    for (int I = 0; I < 100; I++)
+    {
+        // Each leaf sits a few levels below the root.
+        std::shared_ptr<LayoutCounter> Parent = Root->AddControl<LayoutCounter>();
+        for (int Depth = 0; Depth < 4; Depth++)
+        {
+            Parent = Parent->AddControl<LayoutCounter>();
+        }
+        Leaves.push_back(Parent);
+    }
+
+    Window->Update();
+    Root->Layouts = 0;
+    for (const std::shared_ptr<LayoutCounter>& Leaf : Leaves)
+    {
+        Leaf->Layouts = 0;
+    }
+
+    // 10000 invalidations in a single frame. Once the root is requested, all leaf requests
+    // are covered by it.
+    for (int I = 0; I < 10000; I++)
+    {
+        if (I == 5000)
+        {
+            Root->InvalidateLayout();
+        }
+
+        Leaves[I % Leaves.size()]->InvalidateLayout();
+    }
+
+    Window->Update();
+    VERIFYF(Root->Layouts == 1, "Root was laid out %d times", Root->Layouts);
+    for (const std::shared_ptr<LayoutCounter>& Leaf : Leaves)
+    {
+        VERIFYF(Leaf->Layouts == 1, "Leaf was laid out %d times", Leaf->Layouts);
+    }
+
+    // Requests are tracked per generation, so the same leaf can be requested again.
+    Leaves[0]->InvalidateLayout();
+    Window->Update();
+    VERIFY(Leaves[0]->Layouts == 2 && Root->Layouts == 1);
+
+    return true;
+})
+
+
+TEST_CASE(MeasureCache,
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "VerticalContainer", "ID": "Container", "Spacing": [0, 0]})", List);
+
+    const std::shared_ptr<OctaneGUI::Container> Root = List.To<OctaneGUI::Container>("Container");
+    const std::shared_ptr<MeasureCounter> First = Root->AddControl<MeasureCounter>();
+    const std::shared_ptr<MeasureCounter> Second = Root->AddControl<MeasureCounter>();
+    First->SetSpacing({ 0.0f, 0.0f });
+    Second->SetSpacing({ 0.0f, 0.0f });
+    const std::shared_ptr<OctaneGUI::Panel> Leaf = First->AddControl<OctaneGUI::Panel>();
+    Leaf->SetSize({ 20.0f, 10.0f });
+    Second->AddControl<OctaneGUI::Panel>()->SetSize({ 5.0f, 5.0f });
+
+    VERIFY(Root->CachedDesiredSize() == OctaneGUI::Vector2(20.0f, 15.0f));
+    VERIFY(Root->CachedDesiredSize() == OctaneGUI::Vector2(20.0f, 15.0f));
+    VERIFYF(First->Measures == 1 && Second->Measures == 1, "Measured %d and %d times", First->Measures, Second->Measures);
+
+    // Resizing a child only measures the branch it belongs to again.
+    Leaf->SetSize({ 30.0f, 10.0f });
+    VERIFY(Root->CachedDesiredSize() == OctaneGUI::Vector2(30.0f, 15.0f));
+    VERIFYF(First->Measures == 2 && Second->Measures == 1, "Measured %d and %d times", First->Measures, Second->Measures);
+
+    Second->AddControl<OctaneGUI::Panel>()->SetSize({ 5.0f, 5.0f });
+    VERIFY(Root->CachedDesiredSize() == OctaneGUI::Vector2(30.0f, 20.0f));
+    VERIFYF(First->Measures == 2 && Second->Measures == 2, "Measured %d and %d times", First->Measures, Second->Measures);
+
+    return true;
+})
+
+TEST_CASE(MeasurePropertyChange,
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "TabContainer", "ID": "Tabs", "Tabs": [{"Label": "One"}]})", List);
+
+    const std::shared_ptr<OctaneGUI::Container> Tabs = List.To<OctaneGUI::Container>("Tabs");
+    const OctaneGUI::Container* Contents = Tabs->Get(0)->AsContainer();
+    VERIFY(Contents != nullptr);
+
+    const OctaneGUI::Vector2 Padding = Tabs->GetProperty(OctaneGUI::ThemeProperties::Tab_Padding).Vector();
+    const OctaneGUI::Vector2 Size = Contents->CachedDesiredSize();
+
+    // Tabs read their padding from the inherited theme property.
+    Tabs->SetProperty(OctaneGUI::ThemeProperties::Tab_Padding, Padding + OctaneGUI::Vector2(10.0f, 10.0f));
+    const OctaneGUI::Vector2 Padded = Contents->CachedDesiredSize();
+    VERIFYF(Padded.Y == Size.Y + 20.0f, "Desired height %f, expected %f", Padded.Y, Size.Y + 20.0f);
+
+    Tabs->ClearProperty(OctaneGUI::ThemeProperties::Tab_Padding);
+    VERIFY(Contents->CachedDesiredSize() == Size);
+
+    return true;
+})
+
+TEST_CASE(ThemeReloadLayout,
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "TabContainer", "ID": "Tabs", "Tabs": [{"Label": "One"}]})", List);
+
+    const std::shared_ptr<OctaneGUI::Container> Tabs = List.To<OctaneGUI::Container>("Tabs");
+    const std::shared_ptr<OctaneGUI::Control> Tab = Tabs->Get(0)->AsContainer()->Get(0)->AsContainer()->Get(0);
+    const std::shared_ptr<OctaneGUI::Theme> Theme = Application.GetTheme();
+    const OctaneGUI::Vector2 Padding = Theme->Get(OctaneGUI::ThemeProperties::Tab_Padding).Vector();
+    const OctaneGUI::Vector2 Size = Tab->GetSize();
+
+    Theme->Load(OctaneGUI::Json::Parse(R"({"Tab_Padding": [30, 30]})"));
+    Application.GetMainWindow()->Update();
+    const OctaneGUI::Vector2 Padded = Tab->GetSize();
+
+    OctaneGUI::Json Restore(OctaneGUI::Json::Type::Object);
+    OctaneGUI::Json RestorePadding(OctaneGUI::Json::Type::Array);
+    RestorePadding.Push(Padding.X);
+    RestorePadding.Push(Padding.Y);
+    Restore["Tab_Padding"] = std::move(RestorePadding);
+    Theme->Load(Restore);
+    Application.GetMainWindow()->Update();
+
+    const OctaneGUI::Vector2 Expected = Size + (OctaneGUI::Vector2(30.0f, 30.0f) - Padding) * 2.0f;
+    VERIFYF(Padded == Expected, "Tab size is %.2fx%.2f, expected %.2fx%.2f", Padded.X, Padded.Y, Expected.X, Expected.Y);
+    VERIFY(Tab->GetSize() == Size);
+
+    return true;
+})
+
+TEST_CASE(IsContainer,
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "VerticalContainer", "ID": "Container", "Controls": [{"Type": "Text", "ID": "Text"}, {"Type": "MarginContainer", "ID": "Margin"}]})", List);
+
+    const std::shared_ptr<OctaneGUI::Control> Root = List.To<OctaneGUI::Control>("Container");
+    const std::shared_ptr<OctaneGUI::Control> Text = List.To<OctaneGUI::Control>("Container.Text");
+    const std::shared_ptr<OctaneGUI::Control> Margin = List.To<OctaneGUI::Control>("Container.Margin");
+
+    VERIFY(Root->IsContainer() && Root->AsContainer() == List.To<OctaneGUI::Container>("Container").get());
+    VERIFY(Margin->IsContainer() && Margin->AsContainer() == std::dynamic_pointer_cast<OctaneGUI::Container>(Margin).get());
+    VERIFY(!Text->IsContainer() && Text->AsContainer() == nullptr);
+
+    return true;
+})
+
+
+TEST_CASE(HitGrid,
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "Container", "ID": "Container", "Size": [400, 400]})", List);
+
+    // Enough overlapping children to use the grid, with a nested container that extends past
+    // its own bounds.
+    const std::shared_ptr<OctaneGUI::Container> Root = List.To<OctaneGUI::Container>("Container");
+    for (int I = 0; I < 200; I++)
+    {
+        Root->AddControl<OctaneGUI::Panel>()
+            ->SetPosition({ (float)(I % 20) * 19.0f, (float)(I / 20) * 37.0f })
+            .SetSize({ 25.0f, 40.0f });
+    }
+
+    const std::shared_ptr<OctaneGUI::Container> Nested = Root->AddControl<OctaneGUI::Container>();
+    Nested->SetPosition({ 100.0f, 100.0f }).SetSize({ 10.0f, 10.0f });
+    const std::shared_ptr<OctaneGUI::Panel> Overflow = Nested->AddControl<OctaneGUI::Panel>();
+    Overflow->SetPosition({ 50.0f, 50.0f }).SetSize({ 30.0f, 30.0f });
+
+    VERIFY(MatchesReference(Root));
+    VERIFY(Root->GetControl({ 165.0f, 165.0f }).lock() == Overflow);
+
+    // Moving a nested child updates the grids that contain it.
+    Overflow->SetPosition({ 250.0f, 10.0f });
+    VERIFY(Root->GetControl({ 365.0f, 125.0f }).lock() == Overflow);
+    VERIFY(MatchesReference(Root));
+
+    Root->RemoveControl(Nested);
+    VERIFY(MatchesReference(Root));
+
+    // Children outside a clipped container can not be hovered.
+    Root->SetClip(true);
+    Root->AddControl<OctaneGUI::Panel>()->SetPosition({ 390.0f, 390.0f }).SetSize({ 30.0f, 30.0f });
+    VERIFY(Root->GetControl({ 395.0f, 395.0f }).lock() != nullptr);
+    VERIFY(Root->GetControl({ 410.0f, 410.0f }).expired());
+
+    return true;
+})
+
+
+TEST_CASE(IncrementalLayout,
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "VerticalContainer", "ID": "Container"})", List);
+
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    const std::shared_ptr<LayoutCounter> Form = List.To<OctaneGUI::Container>("Container")->AddControl<LayoutCounter>();
+    std::vector<std::shared_ptr<LayoutCounter>> Rows;
+    for (int I = 0; I < 50; I++)
+    {
+        const std::shared_ptr<LayoutCounter> Row = Form->AddControl<LayoutCounter>();
+        Row->AddControl<OctaneGUI::Text>()->SetText("Label");
+        Rows.push_back(Row);
+    }
+
+    const std::shared_ptr<OctaneGUI::TextInput> Input = Rows[10]->AddControl<OctaneGUI::TextInput>();
+    Input->SetSize({ 200.0f, 24.0f });
+
+    Window->Update();
+    VERIFY(Form->Layouts > 0);
+
+    const auto Reset = [&]() -> void
+    {
+        Form->Layouts = 0;
+        for (const std::shared_ptr<LayoutCounter>& Row : Rows)
+        {
+            Row->Layouts = 0;
+        }
+    };
+
+    const auto RowLayouts = [&]() -> int
+    {
+        int Result = 0;
+        for (const std::shared_ptr<LayoutCounter>& Row : Rows)
+        {
+            Result += Row->Layouts;
+        }
+        return Result;
+    };
+
+    // Typing does not change the size of the input, so nothing else in the form is placed.
+    Utility::MouseClick(Application, Input->GetAbsolutePosition() + OctaneGUI::Vector2(2.0f, 2.0f));
+    Window->Update();
+    Reset();
+    Utility::TextEvent(Application, U"Hello");
+    Window->Update();
+    VERIFY(Input->GetString() == U"Hello");
+    VERIFYF(Form->Layouts == 0 && RowLayouts() == 0, "Form laid out %d times and rows %d times", Form->Layouts, RowLayouts());
+
+    // A row that wants to be taller is placed again by the form. The other rows keep their
+    // size and are skipped.
+    Rows[20]->AddControl<OctaneGUI::Panel>()->SetSize({ 10.0f, 100.0f });
+    Window->Update();
+    VERIFYF(Form->Layouts == 1 && Rows[20]->Layouts == 1 && RowLayouts() == 1, "Form laid out %d times and rows %d times", Form->Layouts, RowLayouts());
+    VERIFY(Rows[20]->GetSize().Y >= 100.0f);
+    VERIFY(Rows[21]->GetPosition().Y >= Rows[20]->GetPosition().Y + 100.0f);
+
+    return true;
+})
+
 )
 
 }
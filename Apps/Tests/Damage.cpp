@@ -0,0 +1,267 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+#include "Utility.h"
+
+#include <algorithm>
+
+namespace Tests
+{
+
+// Paints the main window and returns the damage regions given to the OnPaint callback.
+static std::vector<OctaneGUI::Rect> SubmitDamage(OctaneGUI::Application& Application)
+{
+    std::vector<OctaneGUI::Rect> Result;
+    Application.SetOnPaint([&](OctaneGUI::Window*, const OctaneGUI::VertexBuffer&, const std::vector<OctaneGUI::Rect>& Damage) -> void
+        {
+            Result = Damage;
+        });
+    Application.GetMainWindow()->DoPaint();
+    Application.SetOnPaint([](OctaneGUI::Window*, const OctaneGUI::VertexBuffer&, const std::vector<OctaneGUI::Rect>&) -> void {});
+    return Result;
+}
+
+static bool HasDamage(const std::vector<OctaneGUI::Rect>& Damage, const OctaneGUI::Rect& Bounds)
+{
+    return std::find(Damage.begin(), Damage.end(), Bounds) != Damage.end();
+}
+
+static bool CoversDamage(const std::vector<OctaneGUI::Rect>& Damage, const OctaneGUI::Rect& Bounds)
+{
+    for (const OctaneGUI::Rect& Item : Damage)
+    {
+        if (Item.Encompasses(Bounds))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Adds a control that counts how many times it is painted.
+static std::shared_ptr<OctaneGUI::CustomControl> AddCounter(OctaneGUI::Container& Parent, const OctaneGUI::Rect& Bounds, int& Count)
+{
+    std::shared_ptr<OctaneGUI::CustomControl> Result = Parent.AddControl<OctaneGUI::CustomControl>();
+    Result
+        ->SetOnPaint([&Count](const OctaneGUI::CustomControl&, OctaneGUI::Paint&) -> void
+            {
+                Count++;
+            })
+        .SetPosition(Bounds.Min)
+        .SetSize(Bounds.GetSize());
+    return Result;
+}
+
+TEST_SUITE(Damage,
+
+TEST_CASE(MergeOverlapping,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, "", "", List, 200, 200);
+    Application.Update();
+
+    const std::shared_ptr<OctaneGUI::Window>& Window = Application.GetMainWindow();
+    Window->AddDamage({ 10.0f, 10.0f, 50.0f, 50.0f });
+    Window->AddDamage({ 40.0f, 40.0f, 80.0f, 80.0f });
+    Window->AddDamage({ 150.0f, 150.0f, 160.0f, 160.0f });
+
+    std::vector<OctaneGUI::Rect> Damage = SubmitDamage(Application);
+    VERIFYF(Damage.size() == 2, "Expected 2 damage regions, got %zu", Damage.size());
+    VERIFY(HasDamage(Damage, { 10.0f, 10.0f, 80.0f, 80.0f }));
+    VERIFY(HasDamage(Damage, { 150.0f, 150.0f, 160.0f, 160.0f }));
+
+    // A region that bridges two existing regions merges all three.
+    Window->AddDamage({ 10.0f, 10.0f, 20.0f, 20.0f });
+    Window->AddDamage({ 30.0f, 10.0f, 40.0f, 20.0f });
+    Window->AddDamage({ 15.0f, 12.0f, 35.0f, 18.0f });
+
+    Damage = SubmitDamage(Application);
+    VERIFYF(Damage.size() == 1, "Expected 1 damage region, got %zu", Damage.size());
+    VERIFY(Damage.front() == OctaneGUI::Rect(10.0f, 10.0f, 40.0f, 20.0f));
+
+    return true;
+})
+
+TEST_CASE(CollapseToBounds,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, "", "", List, 200, 200);
+    Application.Update();
+
+    const std::shared_ptr<OctaneGUI::Window>& Window = Application.GetMainWindow();
+    for (int I = 0; I < 8; I++)
+    {
+        const float X = I * 20.0f;
+        Window->AddDamage({ X, 0.0f, X + 10.0f, 10.0f });
+    }
+
+    std::vector<OctaneGUI::Rect> Damage = SubmitDamage(Application);
+    VERIFYF(Damage.size() == 8, "Expected 8 damage regions, got %zu", Damage.size());
+
+    for (int I = 0; I < 9; I++)
+    {
+        const float X = I * 20.0f;
+        Window->AddDamage({ X, 0.0f, X + 10.0f, 10.0f });
+    }
+
+    Damage = SubmitDamage(Application);
+    VERIFYF(Damage.size() == 1, "Expected 1 damage region, got %zu", Damage.size());
+    VERIFY(Damage.front() == OctaneGUI::Rect(0.0f, 0.0f, 170.0f, 10.0f));
+
+    return true;
+})
+
+TEST_CASE(ContainerCulling,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, "", "", List, 200, 200);
+
+    std::shared_ptr<OctaneGUI::Container> Root = std::make_shared<OctaneGUI::Container>(Application.GetMainWindow().get());
+    Root->SetSize({ 200.0f, 200.0f });
+
+    int Left = 0;
+    int Right = 0;
+    AddCounter(*Root, { 0.0f, 0.0f, 50.0f, 50.0f }, Left);
+    AddCounter(*Root, { 100.0f, 0.0f, 150.0f, 50.0f }, Right);
+
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.SetDamage({ { 110.0f, 10.0f, 120.0f, 20.0f } });
+    Root->OnPaint(Brush);
+
+    VERIFYF(Left == 0 && Right == 1, "Left painted %d times, right painted %d times", Left, Right);
+    return true;
+})
+
+TEST_CASE(ScrollableCulling,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, "", "", List, 200, 200);
+
+    std::shared_ptr<OctaneGUI::ScrollableContainer> Root = std::make_shared<OctaneGUI::ScrollableContainer>(Application.GetMainWindow().get());
+    Root->SetSize({ 200.0f, 200.0f });
+
+    int Top = 0;
+    int Bottom = 0;
+    AddCounter(*Root, { 0.0f, 0.0f, 50.0f, 50.0f }, Top);
+    AddCounter(*Root, { 0.0f, 100.0f, 50.0f, 150.0f }, Bottom);
+
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.SetDamage({ { 10.0f, 10.0f, 20.0f, 20.0f } });
+    Root->OnPaint(Brush);
+
+    VERIFYF(Top == 1 && Bottom == 0, "Top painted %d times, bottom painted %d times", Top, Bottom);
+    return true;
+})
+
+TEST_CASE(InvalidateDamage,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, "", "", List, 200, 200);
+
+    int Painted = 0;
+    std::shared_ptr<OctaneGUI::CustomControl> Item = AddCounter(*Application.GetMainWindow()->GetContainer(), { 20.0f, 30.0f, 60.0f, 80.0f }, Painted);
+    Application.Update();
+    VERIFY(Painted == 1);
+
+    const OctaneGUI::Rect Bounds = Item->GetAbsoluteBounds();
+    Item->Invalidate();
+
+    const std::vector<OctaneGUI::Rect> Damage = SubmitDamage(Application);
+    VERIFYF(Damage.size() == 1, "Expected 1 damage region, got %zu", Damage.size());
+    VERIFY(Damage.front() == Bounds);
+
+    return true;
+})
+
+TEST_CASE(ShrinkDamage,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, "", "", List, 200, 200);
+
+    int Painted = 0;
+    std::shared_ptr<OctaneGUI::CustomControl> Item = AddCounter(*Application.GetMainWindow()->GetContainer(), { 20.0f, 30.0f, 60.0f, 80.0f }, Painted);
+    Application.Update();
+
+    const OctaneGUI::Rect Previous = Item->GetAbsoluteBounds();
+    Item->SetSize({ 10.0f, 10.0f });
+    Application.GetMainWindow()->Update();
+
+    const std::vector<OctaneGUI::Rect> Damage = SubmitDamage(Application);
+    VERIFY(CoversDamage(Damage, Previous));
+
+    return true;
+})
+
+TEST_CASE(MoveDamage,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, "", "", List, 200, 200);
+
+    int Painted = 0;
+    std::shared_ptr<OctaneGUI::CustomControl> Item = AddCounter(*Application.GetMainWindow()->GetContainer(), { 20.0f, 30.0f, 60.0f, 80.0f }, Painted);
+    Application.Update();
+
+    const OctaneGUI::Rect Previous = Item->GetAbsoluteBounds();
+    Item->SetPosition({ 120.0f, 130.0f });
+    Item->Invalidate();
+
+    const std::vector<OctaneGUI::Rect> Damage = SubmitDamage(Application);
+    VERIFY(CoversDamage(Damage, Previous));
+    VERIFY(CoversDamage(Damage, Item->GetAbsoluteBounds()));
+
+    return true;
+})
+
+TEST_CASE(LayoutMoveDamage,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, R"({"Type": "VerticalContainer", "ID": "Column", "Spacing": [0, 0], "Controls": [
+        {"Type": "Panel", "ID": "Top", "Size": [50, 50]},
+        {"Type": "Panel", "ID": "Bottom", "Size": [50, 50]}
+    ]})", List);
+    Application.Update();
+
+    const std::shared_ptr<OctaneGUI::Control> Bottom = List.To<OctaneGUI::Control>("Column.Bottom");
+    const OctaneGUI::Rect Previous = Bottom->GetAbsoluteBounds();
+
+    List.To<OctaneGUI::Control>("Column.Top")->SetSize({ 50.0f, 10.0f });
+    Application.GetMainWindow()->Update();
+    VERIFY(!(Bottom->GetAbsoluteBounds() == Previous));
+
+    const std::vector<OctaneGUI::Rect> Damage = SubmitDamage(Application);
+    VERIFY(CoversDamage(Damage, Previous));
+    VERIFY(CoversDamage(Damage, Bottom->GetAbsoluteBounds()));
+
+    return true;
+})
+
+)
+
+}
@@ -0,0 +1,129 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+#include <thread>
+#include <vector>
+
+namespace Tests
+{
+
+TEST_SUITE(DispatchQueue,
+
+TEST_CASE(Order,
+{
+    OctaneGUI::DispatchQueue Queue;
+    VERIFY(Queue.IsEmpty());
+
+    std::vector<int> Results;
+    for (int I = 0; I < 4; I++)
+    {
+        Queue.Push([&Results, I]() -> void
+            {
+                Results.push_back(I);
+            });
+    }
+
+    VERIFY(!Queue.IsEmpty());
+    VERIFY(Queue.Run() == 4);
+    VERIFY(Queue.IsEmpty());
+    VERIFY(Results == std::vector<int>({ 0, 1, 2, 3 }));
+
+    return true;
+})
+
+TEST_CASE(PushWhileRunning,
+{
+    OctaneGUI::DispatchQueue Queue;
+
+    int Count = 0;
+    Queue.Push([&]() -> void
+        {
+            Count++;
+            Queue.Push([&]() -> void
+                {
+                    Count++;
+                });
+        });
+
+    VERIFY(Queue.Run() == 1);
+    VERIFY(Count == 1);
+    VERIFY(Queue.Run() == 1);
+    VERIFY(Count == 2);
+
+    return true;
+})
+
+TEST_CASE(MultipleProducers,
+{
+    OctaneGUI::DispatchQueue Queue;
+
+    const int Producers = 4;
+    const int Iterations = 1000;
+    std::vector<int> Last(Producers, -1);
+    bool Ordered = true;
+    size_t Total = 0;
+
+    std::vector<std::thread> Threads;
+    for (int Producer = 0; Producer < Producers; Producer++)
+    {
+        Threads.emplace_back([&, Producer]() -> void
+            {
+                for (int I = 0; I < Iterations; I++)
+                {
+                    Queue.Push([&, Producer, I]() -> void
+                        {
+                            Ordered &= Last[Producer] + 1 == I;
+                            Last[Producer] = I;
+                        });
+                }
+            });
+    }
+
+    // Consume while the producers are still pushing.
+    while (Total < (size_t)(Producers * Iterations))
+    {
+        Total += Queue.Run();
+        std::this_thread::yield();
+    }
+
+    for (std::thread& Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    VERIFY(Ordered);
+    VERIFY(Queue.IsEmpty());
+
+    return true;
+})
+
+)
+
+}
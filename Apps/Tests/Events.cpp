@@ -0,0 +1,398 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+#include "Utility.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+
+namespace Tests
+{
+
+TEST_SUITE(Events,
+
+TEST_CASE(Coalesce,
+{
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    const OctaneGUI::Vector2 Size = Window->GetSize();
+
+    std::vector<OctaneGUI::Event> Events;
+    Events.emplace_back(OctaneGUI::Event::MouseMove(1.0f, 1.0f));
+    Events.emplace_back(OctaneGUI::Event::MouseMove(2.0f, 2.0f));
+    Events.emplace_back(OctaneGUI::Event::MouseMove(3.0f, 3.0f));
+    Events.emplace_back(OctaneGUI::Event::Type::MousePressed, OctaneGUI::Event::MouseButton(OctaneGUI::Mouse::Button::Left, 3.0f, 3.0f, OctaneGUI::Mouse::Count::Single));
+    Events.emplace_back(OctaneGUI::Event::MouseMove(4.0f, 4.0f));
+    Events.emplace_back(OctaneGUI::Event::Type::MouseReleased, OctaneGUI::Event::MouseButton(OctaneGUI::Mouse::Button::Left, 4.0f, 4.0f, OctaneGUI::Mouse::Count::Single));
+    Events.emplace_back(OctaneGUI::Event::MouseWheel(0, 1));
+    Events.emplace_back(OctaneGUI::Event::MouseWheel(0, 2));
+    Events.emplace_back(OctaneGUI::Event::WindowResized(800.0f, 600.0f));
+    Events.emplace_back(OctaneGUI::Event::WindowResized(1000.0f, 700.0f));
+
+    size_t Next = 0;
+    Application.SetOnEvent([&](OctaneGUI::Window* Target) -> OctaneGUI::Event
+        {
+            if (Target != Window.get() || Next >= Events.size())
+            {
+                return OctaneGUI::Event(OctaneGUI::Event::Type::None);
+            }
+
+            return Events[Next++];
+        });
+
+    const uint32_t Coalesced = Application.CoalescedEvents();
+    const int Processed = Application.RunFrame();
+
+    // The tests expect the frontend to close the application once they complete.
+    Application.SetOnEvent([](OctaneGUI::Window*) -> OctaneGUI::Event
+        {
+            return OctaneGUI::Event(OctaneGUI::Event::Type::WindowClosed);
+        });
+
+    const OctaneGUI::Vector2 Resized = Window->GetSize();
+    const OctaneGUI::Vector2 Mouse = Window->GetMousePosition();
+    Window->SetSize(Size);
+
+    VERIFYF(Processed == 6, "Processed %d events", Processed);
+    VERIFY(Application.CoalescedEvents() - Coalesced == 4);
+    VERIFY(Resized == OctaneGUI::Vector2(1000.0f, 700.0f));
+    VERIFY(Mouse == OctaneGUI::Vector2(4.0f, 4.0f));
+
+    return true;
+})
+
+TEST_CASE(DeferredLayout,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, R"({"Type": "HorizontalContainer", "Controls": [
+        {"ID": "A", "Type": "VerticalContainer"},
+        {"ID": "B", "Type": "VerticalContainer"},
+        {"ID": "C", "Type": "VerticalContainer"}
+    ]})", List);
+
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    Window->DoPaint();
+    VERIFY(!Window->NeedsUpdate());
+
+    for (const char* ID : { "A", "B", "C" })
+    {
+        List.To<OctaneGUI::Container>(ID)->Invalidate(OctaneGUI::InvalidateType::Layout);
+    }
+
+    // An exhausted budget still processes one request per update.
+    Window->Update(0.0f);
+    Window->DoPaint();
+    VERIFY(Window->NeedsUpdate());
+    Window->Update(0.0f);
+    Window->Update(0.0f);
+    Window->DoPaint();
+    VERIFY(!Window->NeedsUpdate());
+
+    return true;
+})
+
+TEST_CASE(FrameTimings,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, R"({"ID": "A", "Type": "VerticalContainer"})", List);
+
+    Application.SetOnEvent([](OctaneGUI::Window*) -> OctaneGUI::Event
+        {
+            return OctaneGUI::Event(OctaneGUI::Event::Type::None);
+        });
+
+    Application.SetFrameBudget(1000);
+    List.To<OctaneGUI::Container>("A")->Invalidate(OctaneGUI::InvalidateType::Layout);
+    Application.RunFrame();
+    Application.SetFrameBudget(0);
+
+    Application.SetOnEvent([](OctaneGUI::Window*) -> OctaneGUI::Event
+        {
+            return OctaneGUI::Event(OctaneGUI::Event::Type::WindowClosed);
+        });
+
+    const OctaneGUI::Application::FrameTimings& Timings = Application.GetFrameTimings();
+    VERIFY(Timings.Events >= 0.0f && Timings.Layout >= 0.0f && Timings.Paint >= 0.0f);
+    VERIFY(Timings.Deferred == 0);
+    VERIFY(!Application.GetMainWindow()->NeedsUpdate());
+
+    return true;
+})
+
+TEST_CASE(RecordReplay,
+{
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    const OctaneGUI::Vector2 Size = Window->GetSize();
+    const char* Path = "EventRecording.bin";
+
+    std::vector<OctaneGUI::Event> Events;
+    Events.emplace_back(OctaneGUI::Event::MouseMove(10.0f, 20.0f));
+    Events.emplace_back(OctaneGUI::Event::Type::MousePressed, OctaneGUI::Event::MouseButton(OctaneGUI::Mouse::Button::Right, 10.0f, 20.0f, OctaneGUI::Mouse::Count::Double));
+    Events.emplace_back(OctaneGUI::Event::Type::KeyPressed, OctaneGUI::Event::Key(OctaneGUI::Keyboard::Key::Down));
+    Events.emplace_back(OctaneGUI::Event::Text(U'x'));
+    Events.emplace_back(OctaneGUI::Event::MouseWheel(0, -3));
+    Events.emplace_back(OctaneGUI::Event::WindowResized(640.0f, 480.0f));
+    Events.emplace_back(OctaneGUI::Event::Type::WindowLostFocus);
+
+    size_t Next = 0;
+    Application.SetOnEvent([&](OctaneGUI::Window* Target) -> OctaneGUI::Event
+        {
+            if (Target != Window.get() || Next >= Events.size())
+            {
+                return OctaneGUI::Event(OctaneGUI::Event::Type::None);
+            }
+
+            return Events[Next++];
+        });
+
+    const bool Opened = Application.StartRecording(Path);
+    Application.RunFrame();
+    Application.StopRecording();
+
+    Application.SetOnEvent([](OctaneGUI::Window*) -> OctaneGUI::Event
+        {
+            return OctaneGUI::Event(OctaneGUI::Event::Type::WindowClosed);
+        });
+    Window->SetSize(Size);
+
+    OctaneGUI::EventPlayer Player;
+    const bool Loaded = Player.Load(Path);
+    std::remove(Path);
+
+    VERIFY(Opened && Loaded);
+    VERIFYF(Player.Count() == Events.size(), "Loaded %zu events", Player.Count());
+    VERIFY(Player.Next("Other").GetType() == OctaneGUI::Event::Type::None);
+
+    for (const OctaneGUI::Event& Expected : Events)
+    {
+        const OctaneGUI::Event Played = Player.Next("Main");
+        VERIFY(Played.GetType() == Expected.GetType());
+    }
+
+    VERIFY(Player.IsFinished());
+    VERIFY(Player.NextDeadline() == -1);
+
+    Player.Start();
+    VERIFY(Player.Next("Main").GetData().m_MouseMove.m_Position == OctaneGUI::Vector2(10.0f, 20.0f));
+    const OctaneGUI::Event::MouseButton Button = Player.Next("Main").GetData().m_MouseButton;
+    VERIFY(Button.m_Button == OctaneGUI::Mouse::Button::Right && Button.m_Count == OctaneGUI::Mouse::Count::Double);
+    VERIFY(Player.Next("Main").GetData().m_Key.m_Code == OctaneGUI::Keyboard::Key::Down);
+    VERIFY(Player.Next("Main").GetData().m_Text.Code == U'x');
+    VERIFY(Player.Next("Main").GetData().m_MouseWheel.Delta == OctaneGUI::Vector2(0.0f, -3.0f));
+    VERIFY(Player.Next("Main").GetData().m_Resized.m_Size == OctaneGUI::Vector2(640.0f, 480.0f));
+
+    return true;
+})
+
+TEST_CASE(ReplaySkipsUnavailableWindow,
+{
+    const std::shared_ptr<OctaneGUI::Window> Main = Application.GetMainWindow();
+    const std::shared_ptr<OctaneGUI::Window> Second = Application.NewWindow("ReplaySkip", R"({"Title": "Replay", "Width": 320, "Height": 240})");
+    Application.DisplayWindow("ReplaySkip");
+    const char* Path = "EventRecordingSkip.bin";
+
+    bool SentSecond = false;
+    bool SentMain = false;
+    Application.SetOnEvent([&](OctaneGUI::Window* Target) -> OctaneGUI::Event
+        {
+            if (Target == Second.get() && !SentSecond)
+            {
+                SentSecond = true;
+                return OctaneGUI::Event(OctaneGUI::Event::Type::WindowLostFocus);
+            }
+
+            if (Target == Main.get() && SentSecond && !SentMain)
+            {
+                SentMain = true;
+                return OctaneGUI::Event(OctaneGUI::Event::MouseMove(5.0f, 5.0f));
+            }
+
+            return OctaneGUI::Event(OctaneGUI::Event::Type::None);
+        });
+
+    const bool Opened = Application.StartRecording(Path);
+    Application.RunFrame();
+    Application.RunFrame();
+    Application.StopRecording();
+
+    Application.SetOnEvent([](OctaneGUI::Window*) -> OctaneGUI::Event
+        {
+            return OctaneGUI::Event(OctaneGUI::Event::Type::WindowClosed);
+        });
+    Application.CloseWindow("ReplaySkip");
+
+    OctaneGUI::EventPlayer Player;
+    const bool Loaded = Player.Load(Path);
+    std::remove(Path);
+
+    VERIFY(Opened && Loaded && SentMain);
+    VERIFYF(Player.Count() == 2, "Loaded %zu events", Player.Count());
+
+    // The first record targets a window that does not exist during playback.
+    Player.Start();
+    VERIFY(Player.Next("Main").GetType() == OctaneGUI::Event::Type::None);
+    const size_t Skipped = Player.SkipUnavailable([](const char* ID) -> bool
+        {
+            return std::string(ID) == "Main";
+        });
+    VERIFYF(Skipped == 1, "Skipped %zu events", Skipped);
+    VERIFY(Player.Next("Main").GetType() == OctaneGUI::Event::Type::MouseMoved);
+    VERIFY(Player.IsFinished());
+
+    return true;
+})
+
+TEST_CASE(InputLatency,
+{
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    Window->DoPaint();
+
+    bool Sent = false;
+    Application.SetOnEvent([&](OctaneGUI::Window* Target) -> OctaneGUI::Event
+        {
+            if (Target != Window.get() || Sent)
+            {
+                return OctaneGUI::Event(OctaneGUI::Event::Type::None);
+            }
+
+            Sent = true;
+            return OctaneGUI::Event(OctaneGUI::Event::Type::KeyPressed, OctaneGUI::Event::Key(OctaneGUI::Keyboard::Key::Down))
+                .SetTimestamp(OctaneGUI::Clock::Timestamp() - 5000);
+        });
+
+    // Input that does not cause a repaint is not measured.
+    Application.InputLatency().Reset();
+    Application.RunFrame();
+    const uint64_t Unpainted = Application.InputLatency().Count();
+
+    Sent = false;
+    Window->GetContainer()->Invalidate();
+    Application.RunFrame();
+
+    Application.SetOnEvent([](OctaneGUI::Window*) -> OctaneGUI::Event
+        {
+            return OctaneGUI::Event(OctaneGUI::Event::Type::WindowClosed);
+        });
+
+    VERIFY(Unpainted == 0);
+    VERIFY(Application.InputLatency().Count() == 1);
+    VERIFY(Application.InputLatency().Min() >= 5000);
+    VERIFY(Window->OldestUnpaintedInput() == 0);
+
+    return true;
+})
+
+TEST_CASE(Post,
+{
+    Application.SetOnEvent([](OctaneGUI::Window*) -> OctaneGUI::Event
+        {
+            return OctaneGUI::Event(OctaneGUI::Event::Type::None);
+        });
+
+    int Woken = 0;
+    Application.SetOnWake([&]() -> void
+        {
+            Woken++;
+        });
+
+    const std::thread::id MainThread = std::this_thread::get_id();
+    bool Ran = false;
+    std::thread Worker([&]() -> void
+        {
+            Application.Post([&]() -> void
+                {
+                    Ran = std::this_thread::get_id() == MainThread;
+                });
+        });
+    Worker.join();
+
+    const int Timeout = Application.WaitTimeout();
+    Application.RunFrame();
+
+    Application.SetOnWake(nullptr);
+    Application.SetOnEvent([](OctaneGUI::Window*) -> OctaneGUI::Event
+        {
+            return OctaneGUI::Event(OctaneGUI::Event::Type::WindowClosed);
+        });
+
+    VERIFY(Woken == 1);
+    VERIFY(Timeout == 0);
+    VERIFY(Ran);
+    VERIFY(Application.WaitTimeout() != 0);
+
+    return true;
+})
+
+TEST_CASE(ParallelPaint,
+{
+    const std::shared_ptr<OctaneGUI::Window> Main = Application.GetMainWindow();
+    const std::shared_ptr<OctaneGUI::Window> Second = Application.NewWindow("ParallelPaint", R"({"Title": "Parallel", "Width": 320, "Height": 240})");
+    Application.DisplayWindow("ParallelPaint");
+
+    const std::thread::id MainThread = std::this_thread::get_id();
+    std::vector<OctaneGUI::Window*> Painted;
+    bool SameThread = true;
+    Application.SetOnPaint([&](OctaneGUI::Window* Target, const OctaneGUI::VertexBuffer&, const std::vector<OctaneGUI::Rect>&) -> void
+        {
+            Painted.push_back(Target);
+            SameThread &= std::this_thread::get_id() == MainThread;
+        });
+    Application.SetOnEvent([](OctaneGUI::Window*) -> OctaneGUI::Event
+        {
+            return OctaneGUI::Event(OctaneGUI::Event::Type::None);
+        });
+
+    Application.SetParallelPaint(true);
+    Main->DoPaint();
+    Second->DoPaint();
+    Painted.clear();
+    Main->GetContainer()->Invalidate();
+    Second->GetContainer()->Invalidate();
+    Application.RunFrame();
+    Application.SetParallelPaint(false);
+
+    Application.SetOnPaint([](OctaneGUI::Window*, const OctaneGUI::VertexBuffer&, const std::vector<OctaneGUI::Rect>&) -> void {});
+    Application.SetOnEvent([](OctaneGUI::Window*) -> OctaneGUI::Event
+        {
+            return OctaneGUI::Event(OctaneGUI::Event::Type::WindowClosed);
+        });
+    Application.CloseWindow("ParallelPaint");
+
+    VERIFYF(Painted.size() == 2, "Painted %zu windows", Painted.size());
+    VERIFY(std::find(Painted.begin(), Painted.end(), Main.get()) != Painted.end());
+    VERIFY(std::find(Painted.begin(), Painted.end(), Second.get()) != Painted.end());
+    VERIFY(SameThread);
+    VERIFY(!Main->NeedsRepaint() && !Second->NeedsRepaint());
+
+    return true;
+})
+
+)
+
+}
@@ -0,0 +1,89 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+namespace Tests
+{
+
+TEST_SUITE(Histogram,
+
+TEST_CASE(Empty,
+{
+    OctaneGUI::Histogram Samples;
+    VERIFY(Samples.Count() == 0);
+    VERIFY(Samples.Percentile(50.0f) == 0);
+    VERIFY(Samples.Mean() == 0.0);
+
+    return true;
+})
+
+TEST_CASE(SmallValuesAreExact,
+{
+    OctaneGUI::Histogram Samples;
+    for (int64_t I = 1; I <= 10; I++)
+    {
+        Samples.Add(I);
+    }
+
+    VERIFY(Samples.Count() == 10);
+    VERIFY(Samples.Min() == 1 && Samples.Max() == 10);
+    VERIFY(Samples.Percentile(50.0f) == 5);
+    VERIFY(Samples.Percentile(100.0f) == 10);
+    VERIFY(Samples.Mean() == 5.5);
+
+    return true;
+})
+
+TEST_CASE(Percentiles,
+{
+    OctaneGUI::Histogram Samples;
+    for (int64_t I = 1; I <= 100000; I++)
+    {
+        Samples.Add(I);
+    }
+
+    const auto IsClose = [](int64_t Value, int64_t Expected) -> bool
+    {
+        return Value >= Expected && (double)Value <= (double)Expected * 1.07;
+    };
+
+    VERIFYF(IsClose(Samples.Percentile(50.0f), 50000), "p50 is %lld", (long long)Samples.Percentile(50.0f));
+    VERIFYF(IsClose(Samples.Percentile(95.0f), 95000), "p95 is %lld", (long long)Samples.Percentile(95.0f));
+    VERIFYF(IsClose(Samples.Percentile(99.0f), 99000), "p99 is %lld", (long long)Samples.Percentile(99.0f));
+    VERIFY(Samples.Percentile(100.0f) == 100000);
+
+    Samples.Reset();
+    VERIFY(Samples.Count() == 0);
+
+    return true;
+})
+
+)
+
+}
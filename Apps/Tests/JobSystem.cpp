@@ -0,0 +1,216 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Tests
+{
+
+// Runs frames until the condition is met so that completions posted by workers are invoked.
+static bool RunFramesUntil(OctaneGUI::Application& Application, const std::function<bool()>& Condition)
+{
+    Application.SetOnEvent([](OctaneGUI::Window*) -> OctaneGUI::Event
+        {
+            return OctaneGUI::Event(OctaneGUI::Event::Type::None);
+        });
+
+    OctaneGUI::Clock Timeout;
+    bool Result = Condition();
+    while (!Result && Timeout.Measure() < 5.0f)
+    {
+        Application.RunFrame();
+        std::this_thread::yield();
+        Result = Condition();
+    }
+
+    Application.SetOnEvent([](OctaneGUI::Window*) -> OctaneGUI::Event
+        {
+            return OctaneGUI::Event(OctaneGUI::Event::Type::WindowClosed);
+        });
+
+    return Result;
+}
+
+static void WaitFor(const std::atomic<bool>& Flag)
+{
+    OctaneGUI::Clock Timeout;
+    while (!Flag && Timeout.Measure() < 5.0f)
+    {
+        std::this_thread::yield();
+    }
+}
+
+TEST_SUITE(JobSystem,
+
+TEST_CASE(Complete,
+{
+    const std::thread::id MainThread = std::this_thread::get_id();
+    std::atomic<bool> WorkerThread { false };
+    bool Completed = false;
+    bool CompletedOnMain = false;
+
+    Application.Jobs().Submit([&](const OctaneGUI::JobSystem::CancellationToken&) -> void
+        {
+            WorkerThread = std::this_thread::get_id() != MainThread;
+        },
+        [&]() -> void
+        {
+            Completed = true;
+            CompletedOnMain = std::this_thread::get_id() == MainThread;
+        });
+
+    VERIFY(Application.Jobs().Workers() > 0);
+    VERIFY(RunFramesUntil(Application, [&]() -> bool { return Completed; }));
+    VERIFY(WorkerThread);
+    VERIFY(CompletedOnMain);
+
+    return true;
+})
+
+TEST_CASE(Cancel,
+{
+    OctaneGUI::JobSystem Jobs(Application);
+    Jobs.Initialize(1);
+
+    std::atomic<bool> Started { false };
+    std::atomic<bool> Release { false };
+    std::atomic<bool> Cancelled { true };
+    std::atomic<bool> Done { false };
+
+    Jobs.Submit([&](const OctaneGUI::JobSystem::CancellationToken&) -> void
+        {
+            Started = true;
+            WaitFor(Release);
+        });
+    WaitFor(Started);
+
+    bool Completed = false;
+    OctaneGUI::JobSystem::CancellationToken Token = Jobs.Submit([&](const OctaneGUI::JobSystem::CancellationToken&) -> void
+        {
+            Cancelled = false;
+        },
+        [&]() -> void
+        {
+            Completed = true;
+        });
+    Jobs.Submit([&](const OctaneGUI::JobSystem::CancellationToken&) -> void
+        {
+            Done = true;
+        });
+
+    Token.Cancel();
+    Release = true;
+    WaitFor(Done);
+    Jobs.Shutdown();
+
+    VERIFY(Done);
+    VERIFY(Cancelled);
+    VERIFY(!Completed);
+
+    return true;
+})
+
+TEST_CASE(Priority,
+{
+    OctaneGUI::JobSystem Jobs(Application);
+    Jobs.Initialize(1);
+
+    std::atomic<bool> Started { false };
+    std::atomic<bool> Release { false };
+    std::atomic<bool> Done { false };
+    std::vector<int> Order;
+
+    Jobs.Submit([&](const OctaneGUI::JobSystem::CancellationToken&) -> void
+        {
+            Started = true;
+            WaitFor(Release);
+        });
+    WaitFor(Started);
+
+    Jobs.Submit([&](const OctaneGUI::JobSystem::CancellationToken&) -> void
+        {
+            Order.push_back(2);
+            Done = true;
+        },
+        nullptr, OctaneGUI::JobSystem::Priority::Low);
+    Jobs.Submit([&](const OctaneGUI::JobSystem::CancellationToken&) -> void
+        {
+            Order.push_back(1);
+        },
+        nullptr, OctaneGUI::JobSystem::Priority::Normal);
+    Jobs.Submit([&](const OctaneGUI::JobSystem::CancellationToken&) -> void
+        {
+            Order.push_back(0);
+        },
+        nullptr, OctaneGUI::JobSystem::Priority::High);
+
+    Release = true;
+    WaitFor(Done);
+    Jobs.Shutdown();
+
+    VERIFY(Order == std::vector<int>({ 0, 1, 2 }));
+
+    return true;
+})
+
+TEST_CASE(NestedJobs,
+{
+    std::atomic<int> Count { 0 };
+    int Completed = 0;
+
+    for (int I = 0; I < 8; I++)
+    {
+        Application.Jobs().Submit([&](const OctaneGUI::JobSystem::CancellationToken&) -> void
+            {
+                for (int J = 0; J < 8; J++)
+                {
+                    Application.Jobs().Submit([&](const OctaneGUI::JobSystem::CancellationToken&) -> void
+                        {
+                            Count++;
+                        },
+                        [&]() -> void
+                        {
+                            Completed++;
+                        });
+                }
+            });
+    }
+
+    VERIFY(RunFramesUntil(Application, [&]() -> bool { return Completed == 64; }));
+    VERIFY(Count == 64);
+
+    return true;
+})
+
+)
+
+}
@@ -38,7 +38,7 @@ OctaneGUI::Event OnEvent(OctaneGUI::Window*)
     return OctaneGUI::Event(OctaneGUI::Event::Type::WindowClosed);
 }
 
-void OnPaint(OctaneGUI::Window*, const OctaneGUI::VertexBuffer&)
+void OnPaint(OctaneGUI::Window*, const OctaneGUI::VertexBuffer&, const std::vector<OctaneGUI::Rect>&)
 {
 }
 
@@ -0,0 +1,279 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "TestSuite.h"
+#include "OctaneGUI/OctaneGUI.h"
+
+namespace Tests
+{
+
+TEST_SUITE(Paint,
+
+TEST_CASE(AdaptiveCircleSteps,
+{
+    OctaneGUI::Paint Small(Application.GetTheme());
+    Small.Circle({ 50.0f, 50.0f }, 2.0f, OctaneGUI::Color::White);
+
+    OctaneGUI::Paint Large(Application.GetTheme());
+    Large.Circle({ 50.0f, 50.0f }, 200.0f, OctaneGUI::Color::White);
+
+    const uint32_t SmallCount = Small.GetBuffer().GetVertexCount();
+    const uint32_t LargeCount = Large.GetBuffer().GetVertexCount();
+    VERIFYF(SmallCount < LargeCount, "Small circle has %u vertices, large circle has %u", SmallCount, LargeCount);
+    VERIFY(Small.GetBuffer().GetIndexCount() == (SmallCount - 2) * 3);
+
+    OctaneGUI::Paint Fixed(Application.GetTheme());
+    Fixed.Circle({ 50.0f, 50.0f }, 2.0f, OctaneGUI::Color::White, 12);
+    VERIFY(Fixed.GetBuffer().GetVertexCount() == 14);
+
+    return true;
+})
+
+TEST_CASE(ArcEndpoints,
+{
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.Arc({ 100.0f, 100.0f }, 10.0f, 0.0f, 90.0f, OctaneGUI::Color::White, 5);
+
+    const std::vector<OctaneGUI::Vertex>& Vertices = Brush.GetBuffer().GetVertices();
+    VERIFY(Vertices.size() == 7);
+    VERIFY(Vertices[0].Position == OctaneGUI::Vector2(100.0f, 100.0f));
+    VERIFY(Vertices[1].Position == OctaneGUI::Vector2(110.0f, 100.0f));
+    VERIFY(Vertices[6].Position == OctaneGUI::Vector2(100.0f, 110.0f));
+
+    return true;
+})
+
+TEST_CASE(RoundedRectangleFans,
+{
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.RectangleRounded({ 10.0f, 10.0f, 110.0f, 60.0f }, OctaneGUI::Color::White, { 8.0f, 8.0f, 8.0f, 8.0f });
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFY(Buffer.Commands().size() == 1);
+
+    const std::vector<OctaneGUI::Vertex>& Vertices = Buffer.GetVertices();
+    const std::vector<uint32_t>& Indices = Buffer.GetIndices();
+    VERIFY(Buffer.Commands().front().IndexCount() == Indices.size());
+
+    // Every arc triangle fans out from the center of its corner.
+    const OctaneGUI::Rect Inner(18.0f, 18.0f, 102.0f, 52.0f);
+    for (size_t I = 5 * 6; I < Indices.size(); I += 3)
+    {
+        VERIFY(Indices[I] < Vertices.size() && Indices[I + 1] < Vertices.size() && Indices[I + 2] < Vertices.size());
+
+        const OctaneGUI::Vector2& Center = Vertices[Indices[I]].Position;
+        VERIFYF((Center.X == Inner.Min.X || Center.X == Inner.Max.X) && (Center.Y == Inner.Min.Y || Center.Y == Inner.Max.Y),
+            "Triangle %zu fans from %.1f, %.1f", I / 3, Center.X, Center.Y);
+    }
+
+    return true;
+})
+
+TEST_CASE(Primitives,
+{
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.SetUsePrimitives(true);
+    Brush.RectangleRounded({ 10.0f, 10.0f, 110.0f, 60.0f }, OctaneGUI::Color::White, { 8.0f, 8.0f, 8.0f, 8.0f });
+    Brush.Rectangle3DRounded({ 10.0f, 70.0f, 110.0f, 120.0f }, { 4.0f, 4.0f, 4.0f, 4.0f }, OctaneGUI::Color::White, OctaneGUI::Color::White, OctaneGUI::Color::Black);
+    Brush.Circle({ 50.0f, 50.0f }, 20.0f, OctaneGUI::Color::White);
+    Brush.Line({ 0.0f, 0.0f }, { 20.0f, 20.0f }, OctaneGUI::Color::White);
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFY(Buffer.GetVertexCount() == 0 && Buffer.GetIndexCount() == 0);
+    VERIFY(Buffer.GetPrimitives().size() == 4);
+    VERIFYF(Buffer.Commands().size() == 1, "Expected 1 command, got %zu", Buffer.Commands().size());
+    VERIFY(Buffer.Commands().front().IsPrimitive() && Buffer.Commands().front().PrimitiveCount() == 4);
+    VERIFY(Buffer.GetPrimitives()[1].Border == OctaneGUI::Color::White && Buffer.GetPrimitives()[1].BorderShadow == OctaneGUI::Color::Black);
+    VERIFY(Buffer.GetPrimitives()[3].Shape == OctaneGUI::Primitive::Type::Line);
+
+    // Triangles in between split the primitives into separate commands.
+    Brush.Text(Application.GetTheme()->GetFont(), { 0.0f, 0.0f }, U"Text", OctaneGUI::Color::White);
+    Brush.Rectangle({ 0.0f, 0.0f, 10.0f, 10.0f }, OctaneGUI::Color::White);
+    VERIFY(Buffer.Commands().size() == 3);
+    VERIFY(!Buffer.Commands()[1].IsPrimitive() && Buffer.Commands()[2].PrimitiveOffset() == 4);
+
+    return true;
+})
+
+TEST_CASE(PrimitiveFallback,
+{
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.RectangleRounded({ 10.0f, 10.0f, 110.0f, 60.0f }, OctaneGUI::Color::White, { 8.0f, 8.0f, 8.0f, 8.0f });
+    Brush.Circle({ 50.0f, 50.0f }, 20.0f, OctaneGUI::Color::White);
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFY(Buffer.GetPrimitives().empty());
+    VERIFY(Buffer.GetVertexCount() > 0);
+    VERIFY(!Buffer.Commands().front().IsPrimitive());
+
+    return true;
+})
+
+TEST_CASE(PrimitiveReplay,
+{
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.SetUsePrimitives(true);
+    Brush.BeginCapture();
+    Brush.Rectangle({ 0.0f, 0.0f, 10.0f, 10.0f }, OctaneGUI::Color::White);
+    Brush.Text(Application.GetTheme()->GetFont(), { 0.0f, 0.0f }, U"Text", OctaneGUI::Color::White);
+    Brush.Circle({ 50.0f, 50.0f }, 20.0f, OctaneGUI::Color::White);
+    Brush.Line({ 0.0f, 0.0f }, { 20.0f, 20.0f }, OctaneGUI::Color::White);
+
+    OctaneGUI::VertexBuffer::Capture Geometry;
+    Brush.EndCapture(Geometry);
+    VERIFY(Geometry.Primitives.size() == 3);
+
+    OctaneGUI::Paint Target(Application.GetTheme());
+    Target.Replay(Geometry);
+
+    const OctaneGUI::VertexBuffer& Source = Brush.GetBuffer();
+    const OctaneGUI::VertexBuffer& Result = Target.GetBuffer();
+    VERIFY(Result.Commands().size() == Source.Commands().size());
+    VERIFY(Result.GetPrimitives().size() == 3);
+    VERIFY(Result.GetVertexCount() == Source.GetVertexCount());
+    VERIFY(Result.Commands()[2].IsPrimitive() && Result.Commands()[2].PrimitiveCount() == 2);
+
+    return true;
+})
+
+TEST_CASE(CircleOutlineSingleCommand,
+{
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.CircleOutline({ 50.0f, 50.0f }, 40.0f, OctaneGUI::Color::White, 1.0f, 64);
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFYF(Buffer.Commands().size() == 1, "Expected 1 command, got %zu", Buffer.Commands().size());
+    VERIFY(Buffer.GetIndexCount() == 64 * 6);
+
+    for (uint32_t Index : Buffer.GetIndices())
+    {
+        VERIFY(Index < Buffer.GetVertexCount());
+    }
+
+    return true;
+})
+
+TEST_CASE(PolylineJoins,
+{
+    OctaneGUI::Paint Mitered(Application.GetTheme());
+    Mitered.Polyline(std::vector<OctaneGUI::Vector2>({ { 0.0f, 0.0f }, { 10.0f, 0.0f }, { 10.0f, 10.0f } }), OctaneGUI::Color::White, 2.0f);
+
+    const std::vector<OctaneGUI::Vertex>& Vertices = Mitered.GetBuffer().GetVertices();
+    VERIFY(Vertices.size() == 6);
+    VERIFY(Mitered.GetBuffer().GetIndexCount() == 12);
+    VERIFY((Vertices[2].Position - OctaneGUI::Vector2(9.0f, 1.0f)).Length() < 0.001f);
+    VERIFY((Vertices[3].Position - OctaneGUI::Vector2(11.0f, -1.0f)).Length() < 0.001f);
+
+    // A sharp turn exceeds the miter limit and is beveled.
+    OctaneGUI::Paint Sharp(Application.GetTheme());
+    Sharp.Polyline(std::vector<OctaneGUI::Vector2>({ { 0.0f, 0.0f }, { 100.0f, 0.0f }, { 0.0f, 5.0f } }), OctaneGUI::Color::White, 2.0f);
+    VERIFY(Sharp.GetBuffer().GetVertexCount() == 9);
+    VERIFY(Sharp.GetBuffer().GetIndexCount() == 18);
+
+    OctaneGUI::Paint Beveled(Application.GetTheme());
+    Beveled.Polyline(std::vector<OctaneGUI::Vector2>({ { 0.0f, 0.0f }, { 10.0f, 0.0f }, { 10.0f, 10.0f } }), OctaneGUI::Color::White, 2.0f, false, OctaneGUI::Paint::LineJoin::Bevel);
+    VERIFY(Beveled.GetBuffer().GetVertexCount() == 9);
+
+    return true;
+})
+
+TEST_CASE(Path,
+{
+    OctaneGUI::Path Shape;
+    Shape.MoveTo({ 0.0f, 0.0f }).LineTo({ 10.0f, 0.0f }).LineTo({ 10.0f, 10.0f }).Close();
+    Shape.MoveTo({ 20.0f, 0.0f }).BezierTo({ 30.0f, 0.0f }, { 30.0f, 20.0f }, { 40.0f, 20.0f }, 8);
+    VERIFY(Shape.Contours().size() == 2);
+    VERIFY(Shape.Contours()[1].Count == 9);
+    VERIFY(Shape.Points().back() == OctaneGUI::Vector2(40.0f, 20.0f));
+
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.Path(Shape, OctaneGUI::Color::White, 2.0f);
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFY(Buffer.Commands().size() == 1);
+    VERIFY(Buffer.Commands().front().IndexCount() == Buffer.GetIndexCount());
+
+    return true;
+})
+
+TEST_CASE(TextSpans,
+{
+    std::vector<OctaneGUI::TextSpan> Spans(2);
+    Spans[0].Start = 0;
+    Spans[0].End = 3;
+    Spans[0].TextColor = OctaneGUI::Color::White;
+    Spans[1].Start = 3;
+    Spans[1].End = 6;
+    Spans[1].TextColor = OctaneGUI::Color::Black;
+
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.Textf(Application.GetTheme()->GetFont(), { 0.0f, 0.0f }, U"abcdef", Spans);
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFY(Buffer.Commands().size() == 1);
+    VERIFY(Buffer.GetVertexCount() == 24);
+    VERIFY(Buffer.GetIndexCount() == 36);
+    VERIFY(Buffer.Commands().front().IndexCount() == 36);
+    VERIFY(Buffer.GetVertices()[0].Col == OctaneGUI::Color::White);
+    VERIFY(Buffer.GetVertices()[23].Col == OctaneGUI::Color::Black);
+
+    // Glyphs must advance across spans.
+    VERIFY(Buffer.GetVertices()[12].Position.X > Buffer.GetVertices()[8].Position.X);
+
+    return true;
+})
+
+TEST_CASE(TextWrapped,
+{
+    const std::shared_ptr<OctaneGUI::Font>& Font = Application.GetTheme()->GetFont();
+    const std::u32string Contents = U"one two";
+
+    std::vector<OctaneGUI::TextSpan> Spans(1);
+    Spans[0].Start = 0;
+    Spans[0].End = Contents.size();
+    Spans[0].TextColor = OctaneGUI::Color::White;
+
+    OctaneGUI::Paint Wide(Application.GetTheme());
+    Wide.TextWrapped(Font, { 0.0f, 0.0f }, Contents, Spans, 1000.0f);
+    const std::vector<OctaneGUI::Vertex>& WideVertices = Wide.GetBuffer().GetVertices();
+    VERIFY(WideVertices.size() == Contents.size() * 4);
+    // Both words end or begin with 'o', so their glyphs share the same vertical placement.
+    VERIFY(WideVertices[WideVertices.size() - 4].Position.Y == WideVertices.front().Position.Y);
+
+    const float Width = Font->Measure(U"one ").X + 1.0f;
+    OctaneGUI::Paint Narrow(Application.GetTheme());
+    Narrow.TextWrapped(Font, { 0.0f, 0.0f }, Contents, Spans, Width);
+    const std::vector<OctaneGUI::Vertex>& NarrowVertices = Narrow.GetBuffer().GetVertices();
+    VERIFY(NarrowVertices.size() == Contents.size() * 4);
+    VERIFY(Narrow.GetBuffer().Commands().size() == 1);
+    VERIFY(NarrowVertices[NarrowVertices.size() - 4].Position.Y == NarrowVertices.front().Position.Y + Font->Size());
+
+    return true;
+})
+
+)
+
+}
@@ -48,6 +48,14 @@ TEST_CASE(NoIntersection,
     return RectC == OctaneGUI::Rect(2.0f, 3.0f, 5.0f, 6.0f);
 })
 
+TEST_CASE(Union,
+{
+    const OctaneGUI::Rect RectA(0.0f, 2.0f, 10.0f, 8.0f);
+    const OctaneGUI::Rect RectB(5.0f, 0.0f, 20.0f, 6.0f);
+    const OctaneGUI::Rect RectC = RectA.Union(RectB);
+    return RectC == OctaneGUI::Rect(0.0f, 0.0f, 20.0f, 8.0f);
+})
+
 )
 
 }
@@ -0,0 +1,162 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+#include "Utility.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Counts every heap allocation made by the test executable so that layout can be checked for
+// steady state allocations.
+static std::atomic<uint64_t> g_Allocations { 0 };
+
+void* operator new(std::size_t Size)
+{
+    g_Allocations++;
+    void* Result = std::malloc(Size == 0 ? 1 : Size);
+    if (Result == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return Result;
+}
+
+void operator delete(void* Ptr) noexcept
+{
+    std::free(Ptr);
+}
+
+void operator delete(void* Ptr, std::size_t) noexcept
+{
+    std::free(Ptr);
+}
+
+namespace Tests
+{
+
+TEST_SUITE(ScratchArena,
+
+TEST_CASE(Alignment,
+{
+    OctaneGUI::ScratchArena Arena(64);
+    Arena.Allocate<uint8_t>(1);
+    double* Value = Arena.Allocate<double>(1);
+    VERIFY(reinterpret_cast<uintptr_t>(Value) % alignof(double) == 0);
+    VERIFY(Arena.Used() == 16);
+
+    return true;
+})
+
+TEST_CASE(ScopeReleases,
+{
+    OctaneGUI::ScratchArena Arena(64);
+    Arena.Allocate<uint32_t>(2);
+
+    {
+        const OctaneGUI::ScratchArena::Scope Scope(Arena);
+        Arena.Allocate<uint32_t>(4);
+        VERIFY(Arena.Used() == 24);
+    }
+
+    VERIFY(Arena.Used() == 8);
+
+    return true;
+})
+
+TEST_CASE(MergeBlocks,
+{
+    OctaneGUI::ScratchArena Arena(64);
+    Arena.Allocate<uint8_t>(48);
+    Arena.Allocate<uint8_t>(48);
+    Arena.Allocate<uint8_t>(200);
+    VERIFY(Arena.BlockAllocations() == 3);
+
+    // The next frame fits within the merged block.
+    Arena.Reset();
+    const uint64_t Blocks = Arena.BlockAllocations();
+    Arena.Allocate<uint8_t>(48);
+    Arena.Allocate<uint8_t>(48);
+    Arena.Allocate<uint8_t>(200);
+    VERIFYF(Arena.BlockAllocations() == Blocks, "Allocated %llu blocks", (unsigned long long)(Arena.BlockAllocations() - Blocks));
+
+    return true;
+})
+
+TEST_CASE(SteadyStateLayout,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, R"({"Type": "VerticalContainer", "ID": "Root", "Expand": "Both", "Controls": [
+        {"Type": "HorizontalContainer", "Controls": [
+            {"Type": "Panel", "ID": "Leaf", "Size": [20, 20]},
+            {"Type": "Panel", "Size": [30, 20]},
+            {"Type": "VerticalContainer", "Grow": "Center", "Controls": [
+                {"Type": "Panel", "Size": [10, 10], "Expand": "Width"},
+                {"Type": "Panel", "Size": [10, 10]}
+            ]}
+        ]},
+        {"Type": "Splitter", "Size": [200, 100], "Containers": [
+            {"Controls": [{"Type": "Panel", "Size": [10, 10]}]},
+            {"Controls": [{"Type": "Panel", "Size": [10, 10]}]}
+        ]},
+        {"Type": "Table", "Size": [200, 100], "Header": [{"Label": "One"}, {"Label": "Two"}], "Rows": [{}, {}]},
+        {"Type": "TabContainer", "Size": [200, 100], "Tabs": [
+            {"Label": "One", "Controls": [{"Type": "Panel", "Size": [10, 10]}]},
+            {"Label": "Two", "Controls": [{"Type": "Panel", "Size": [10, 10]}]}
+        ]}
+    ]})", List);
+
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    const std::shared_ptr<OctaneGUI::Control> Leaf = List.To<OctaneGUI::Control>("Root.Leaf");
+    const std::shared_ptr<OctaneGUI::Control> Root = List.To<OctaneGUI::Control>("Root");
+
+    const auto Relayout = [&](float Width) -> void
+    {
+        Leaf->SetSize({ Width, 20.0f });
+        Root->Invalidate(OctaneGUI::InvalidateType::Layout);
+        Window->Update();
+    };
+
+    // The first passes size the arena and the window's request lists.
+    Relayout(40.0f);
+    Relayout(20.0f);
+
+    const uint64_t Allocations = g_Allocations;
+    Relayout(40.0f);
+    Relayout(20.0f);
+    VERIFYF(g_Allocations == Allocations, "Relayout made %llu heap allocations", (unsigned long long)(g_Allocations - Allocations));
+    VERIFY(Window->Scratch().BlockAllocations() == 1);
+
+    return true;
+})
+
+)
+
+}
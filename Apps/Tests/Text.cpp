@@ -31,6 +31,31 @@ SOFTWARE.
 namespace Tests
 {
 
+// Paints the main window and returns whether any vertex has the given color.
+static bool PaintsColor(OctaneGUI::Application& Application, const OctaneGUI::Color& Col)
+{
+    bool Result = false;
+    Application.SetOnPaint([&](OctaneGUI::Window*, const OctaneGUI::VertexBuffer& Buffer, const std::vector<OctaneGUI::Rect>&) -> void
+        {
+            for (const OctaneGUI::Vertex& Item : Buffer.GetVertices())
+            {
+                Result |= Item.Col == Col;
+            }
+        });
+    Application.Update();
+    Application.SetOnPaint([](OctaneGUI::Window*, const OctaneGUI::VertexBuffer&, const std::vector<OctaneGUI::Rect>&) -> void {});
+    return Result;
+}
+
+static OctaneGUI::TextSpan MakeSpan(size_t Start, size_t End, const OctaneGUI::Color& Col)
+{
+    OctaneGUI::TextSpan Result;
+    Result.Start = Start;
+    Result.End = End;
+    Result.TextColor = Col;
+    return Result;
+}
+
 TEST_SUITE(Text,
 
 TEST_CASE(SingleLine,
@@ -66,6 +91,27 @@ TEST_CASE(Wrap,
     return Text->GetSize().Y > Font->Size();
 })
 
+TEST_CASE(SpansRepaint,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, R"({"Type": "Text", "ID": "Text", "Text": "Well Hello Friends!"})", List);
+
+    const OctaneGUI::Color Red(255, 0, 0, 255);
+    const std::shared_ptr<OctaneGUI::Text> Text = List.To<OctaneGUI::Text>("Text");
+    VERIFY(!PaintsColor(Application, Red));
+
+    Text->PushSpan(MakeSpan(0, 4, Red));
+    VERIFY(PaintsColor(Application, Red));
+
+    Text->ClearSpans();
+    VERIFY(!PaintsColor(Application, Red));
+
+    Text->PushSpans(std::vector<OctaneGUI::TextSpan>(1, MakeSpan(5, 10, Red)));
+    VERIFY(PaintsColor(Application, Red));
+
+    return true;
+})
+
 TEST_CASE(ContextMenu,
 {
     OctaneGUI::ControlList List;
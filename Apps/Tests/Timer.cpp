@@ -0,0 +1,161 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+namespace Tests
+{
+
+TEST_SUITE(Timer,
+
+TEST_CASE(NextDeadline,
+{
+    const std::shared_ptr<OctaneGUI::Window>& Window = Application.GetMainWindow();
+    VERIFY(Window->NextTimerDeadline() == -1);
+
+    std::shared_ptr<OctaneGUI::Timer> Slow = Window->CreateTimer(1000, false, []() -> void {});
+    std::shared_ptr<OctaneGUI::Timer> Fast = Window->CreateTimer(500, false, []() -> void {});
+    Slow->Start();
+    Fast->Start();
+
+    const int Deadline = Window->NextTimerDeadline();
+    VERIFYF(Deadline >= 0 && Deadline <= 500, "Deadline is %d", Deadline);
+    VERIFY(Application.WaitTimeout() >= 0 && Application.WaitTimeout() <= 500);
+
+    Fast->Stop();
+    VERIFY(Window->NextTimerDeadline() > 500);
+
+    Slow->Stop();
+    VERIFY(Window->NextTimerDeadline() == -1);
+    VERIFY(Application.WaitTimeout() == -1);
+
+    return true;
+})
+
+TEST_CASE(ExpiredTimerIsDue,
+{
+    const std::shared_ptr<OctaneGUI::Window>& Window = Application.GetMainWindow();
+
+    std::shared_ptr<OctaneGUI::Timer> Object = Window->CreateTimer(0, false, []() -> void {});
+    Object->Start();
+    VERIFY(Window->NextTimerDeadline() == 0);
+
+    Object->Stop();
+    return true;
+})
+
+TEST_CASE(Schedule,
+{
+    const std::shared_ptr<OctaneGUI::Window>& Window = Application.GetMainWindow();
+
+    std::vector<int> Fired;
+    std::vector<std::shared_ptr<OctaneGUI::Timer>> Timers;
+    for (int I = 0; I < 64; I++)
+    {
+        Timers.push_back(Window->CreateTimer(I % 2 == 0 ? 0 : 100000, false, [&Fired, I]() -> void
+            {
+                Fired.push_back(I);
+            }));
+        Timers.back()->Start();
+    }
+
+    // Cancelling timers in the middle of the schedule keeps the remaining ones ordered.
+    Timers[10]->Stop();
+    Timers[11]->Stop();
+    Timers[20].reset();
+    Window->Update();
+
+    bool Ordered = true;
+    for (size_t I = 1; I < Fired.size(); I++)
+    {
+        Ordered &= Fired[I - 1] < Fired[I];
+    }
+
+    VERIFYF(Fired.size() == 30, "Fired %zu timers", Fired.size());
+    VERIFY(Ordered);
+    VERIFY(Window->NextTimerDeadline() > 0);
+
+    Timers.clear();
+    VERIFY(Window->NextTimerDeadline() == -1);
+
+    return true;
+})
+
+TEST_CASE(StopFromCallback,
+{
+    const std::shared_ptr<OctaneGUI::Window>& Window = Application.GetMainWindow();
+
+    int Count = 0;
+    std::shared_ptr<OctaneGUI::Timer> Object = Window->CreateTimer(0, true, nullptr);
+    Object->SetOnTimeout([&]() -> void
+        {
+            Count++;
+            Object->Stop();
+        });
+    Object->Start();
+
+    Window->Update();
+    Window->Update();
+    VERIFY(Count == 1);
+    VERIFY(Window->NextTimerDeadline() == -1);
+
+    return true;
+})
+
+TEST_CASE(OutlivesWindow,
+{
+    std::shared_ptr<OctaneGUI::Window> Window = std::make_shared<OctaneGUI::Window>(&Application);
+
+    int Count = 0;
+    std::shared_ptr<OctaneGUI::Timer> Idle = Window->CreateTimer(0, false, [&]() -> void
+        {
+            Count++;
+        });
+    std::shared_ptr<OctaneGUI::Timer> Scheduled = Window->CreateTimer(100000, true, [&]() -> void
+        {
+            Count++;
+        });
+    Scheduled->Start();
+
+    Window = nullptr;
+
+    // Timers detached from a destroyed window can no longer be scheduled.
+    Idle->Start();
+    Scheduled->Start();
+    Scheduled->Stop();
+    VERIFY(Count == 0);
+    VERIFY(Application.GetMainWindow()->NextTimerDeadline() == -1);
+
+    Idle = nullptr;
+    Scheduled = nullptr;
+    return true;
+})
+
+)
+
+}
@@ -0,0 +1,310 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "TestSuite.h"
+#include "OctaneGUI/OctaneGUI.h"
+#include "Utility.h"
+
+namespace Tests
+{
+
+TEST_SUITE(VertexBuffer,
+
+TEST_CASE(MergeCommands,
+{
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.Rectangle({ 0.0f, 0.0f, 10.0f, 10.0f }, OctaneGUI::Color::White);
+    Brush.Rectangle({ 20.0f, 0.0f, 30.0f, 10.0f }, OctaneGUI::Color::White);
+    Brush.Line({ 0.0f, 20.0f }, { 30.0f, 20.0f }, OctaneGUI::Color::White);
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFYF(Buffer.Commands().size() == 1, "Expected 1 command, got %zu", Buffer.Commands().size());
+    VERIFYF(Buffer.MergedCommands() == 2, "Expected 2 merged commands, got %u", Buffer.MergedCommands());
+
+    const OctaneGUI::DrawCommand& Command = Buffer.Commands().front();
+    VERIFY(Command.IndexCount() == 18);
+    VERIFY(Command.IndexCount() == Buffer.GetIndexCount());
+
+    // Indices for the second rectangle must be rebased to the merged command's vertex offset.
+    const std::vector<uint32_t>& Indices = Buffer.GetIndices();
+    VERIFY(Indices[6] == 4 && Indices[8] == 6 && Indices[11] == 7);
+    VERIFY(Indices[12] == 8 && Indices[17] == 11);
+
+    for (uint32_t Index : Indices)
+    {
+        VERIFY(Command.VertexOffset() + Index < Buffer.GetVertexCount());
+    }
+
+    return true;
+})
+
+TEST_CASE(DifferentClip,
+{
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.Rectangle({ 0.0f, 0.0f, 10.0f, 10.0f }, OctaneGUI::Color::White);
+    Brush.PushClip({ 0.0f, 0.0f, 5.0f, 5.0f });
+    Brush.Rectangle({ 0.0f, 0.0f, 10.0f, 10.0f }, OctaneGUI::Color::White);
+    Brush.Rectangle({ 2.0f, 2.0f, 10.0f, 10.0f }, OctaneGUI::Color::White);
+    Brush.PopClip();
+    Brush.Rectangle({ 0.0f, 0.0f, 10.0f, 10.0f }, OctaneGUI::Color::White);
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFYF(Buffer.Commands().size() == 3, "Expected 3 commands, got %zu", Buffer.Commands().size());
+    VERIFY(Buffer.MergedCommands() == 1);
+    VERIFY(Buffer.Commands()[1].IndexCount() == 12);
+    VERIFY(Buffer.Commands()[2].VertexOffset() == 12);
+    VERIFY(Buffer.GetIndices().back() == 3);
+
+    return true;
+})
+
+TEST_CASE(DifferentTexture,
+{
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.Rectangle({ 0.0f, 0.0f, 10.0f, 10.0f }, OctaneGUI::Color::White);
+    Brush.Text(Application.GetTheme()->GetFont(), { 0.0f, 0.0f }, U"Text", OctaneGUI::Color::White);
+    Brush.Rectangle({ 0.0f, 0.0f, 10.0f, 10.0f }, OctaneGUI::Color::White);
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFYF(Buffer.Commands().size() == 3, "Expected 3 commands, got %zu", Buffer.Commands().size());
+    VERIFY(Buffer.MergedCommands() == 0);
+
+    return true;
+})
+
+TEST_CASE(PaintCache,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, R"({"Type": "Text", "ID": "Text", "Text": "Well Hello Friends!"})", List);
+
+    const std::shared_ptr<OctaneGUI::Text> Text = List.To<OctaneGUI::Text>("Text");
+    const std::shared_ptr<OctaneGUI::Container> Root = Application.GetMainWindow()->GetRootContainer();
+
+    OctaneGUI::Paint First(Application.GetTheme());
+    Root->OnPaint(First);
+
+    OctaneGUI::Paint Second(Application.GetTheme());
+    Root->OnPaint(Second);
+    VERIFY(Second.GetBuffer().Replays() > 0);
+    VERIFY(Second.GetBuffer().GetVertices().size() == First.GetBuffer().GetVertices().size());
+    VERIFY(Second.GetBuffer().GetIndices() == First.GetBuffer().GetIndices());
+    VERIFY(Second.GetBuffer().Commands().size() == First.GetBuffer().Commands().size());
+
+    Text->SetText("Goodbye");
+    OctaneGUI::Paint Third(Application.GetTheme());
+    Root->OnPaint(Third);
+    VERIFY(Third.GetBuffer().Replays() == Second.GetBuffer().Replays() - 1);
+
+    return true;
+})
+
+TEST_CASE(Clear,
+{
+    OctaneGUI::VertexBuffer Buffer;
+    for (int I = 0; I < 2; I++)
+    {
+        Buffer.PushCommand(6, 0, {});
+        Buffer.AddVertices({ { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } }, OctaneGUI::Color::White);
+        for (uint32_t Index : { 0, 1, 2, 0, 2, 3 })
+        {
+            Buffer.AddIndex(Index);
+        }
+        Buffer.Clear();
+    }
+
+    VERIFY(Buffer.GetVertexCount() == 0 && Buffer.GetIndexCount() == 0 && Buffer.Commands().empty());
+
+    const OctaneGUI::VertexBuffer::Statistics Stats = Buffer.GetStatistics();
+    VERIFYF(Stats.Growths == 1, "Expected storage to grow once, grew %u times", Stats.Growths);
+    VERIFY(Stats.MaxVertices == 4 && Stats.MaxIndices == 6 && Stats.MaxCommands == 1);
+    VERIFY(Stats.MaxVertexBytes == 4 * sizeof(OctaneGUI::Vertex) && Stats.MaxIndexBytes == 6 * sizeof(uint32_t));
+
+    return true;
+})
+
+TEST_CASE(WindowReusesBuffer,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, R"({"Type": "Text", "Text": "Well Hello Friends!"}, {"Type": "Button", "Text": {"Text": "Button"}})", List);
+
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    Window->Repaint();
+    Application.Update();
+
+    const OctaneGUI::VertexBuffer::Statistics First = Window->PaintStatistics();
+    VERIFY(First.MaxVertices > 0);
+
+    for (int I = 0; I < 3; I++)
+    {
+        Window->Repaint();
+        Application.Update();
+    }
+
+    const OctaneGUI::VertexBuffer::Statistics Last = Window->PaintStatistics();
+    VERIFYF(Last.Growths == First.Growths, "Buffer grew %u times after the first frame", Last.Growths - First.Growths);
+    VERIFY(Last.MaxVertices == First.MaxVertices);
+
+    return true;
+})
+
+TEST_CASE(Compact,
+{
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.SetCompact(true);
+    Brush.Rectangle({ 10.0f, 20.0f, 30.5f, 40.25f }, OctaneGUI::Color::White);
+    Brush.Text(Application.GetTheme()->GetFont(), { 0.0f, 0.0f }, U"Text", OctaneGUI::Color::White);
+    Brush.Pack();
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    const OctaneGUI::VertexLayout& Layout = Buffer.GetLayout();
+    VERIFY(Layout.IndexSize == sizeof(uint16_t));
+    VERIFY(Layout.Stride == sizeof(OctaneGUI::CompactVertex));
+
+    const size_t Standard = Buffer.GetVertices().size() * sizeof(OctaneGUI::Vertex) + Buffer.GetIndices().size() * sizeof(uint32_t);
+    const size_t Compact = Buffer.GetVertexDataSize() + Buffer.GetIndexDataSize();
+    VERIFYF(Compact * 10 <= Standard * 6, "Compact size %zu is not less than 60%% of %zu", Compact, Standard);
+
+    const OctaneGUI::CompactVertex* Vertices = static_cast<const OctaneGUI::CompactVertex*>(Buffer.GetVertexData());
+    VERIFY(Vertices[2].X * Layout.PositionScale == 30.5f && Vertices[2].Y * Layout.PositionScale == 40.25f);
+
+    const uint16_t* Indices = static_cast<const uint16_t*>(Buffer.GetIndexData());
+    for (size_t I = 0; I < Buffer.GetIndices().size(); I++)
+    {
+        VERIFY(Indices[I] == Buffer.GetIndices()[I]);
+    }
+
+    return true;
+})
+
+TEST_CASE(CompactStatistics,
+{
+    OctaneGUI::VertexBuffer Buffer;
+    Buffer.SetCompact(true);
+
+    const std::vector<OctaneGUI::Vector2> Quad({ { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } });
+    for (int I = 0; I < 2; I++)
+    {
+        Buffer.PushCommand(6, 0, {});
+        Buffer.AddVertices(Quad, OctaneGUI::Color::White);
+        for (uint32_t Index : { 0, 1, 2, 0, 2, 3 })
+        {
+            Buffer.AddIndex(Index);
+        }
+        Buffer.Pack();
+        Buffer.Clear();
+    }
+
+    const OctaneGUI::VertexBuffer::Statistics Stats = Buffer.GetStatistics();
+    VERIFYF(Stats.Growths == 1, "Expected storage to grow once, grew %u times", Stats.Growths);
+    VERIFY(Stats.MaxVertices == 4 && Stats.MaxIndices == 6);
+    VERIFY(Stats.MaxVertexBytes == 4 * sizeof(OctaneGUI::CompactVertex) && Stats.MaxIndexBytes == 6 * sizeof(uint16_t));
+
+    return true;
+})
+
+TEST_CASE(CompactMergeLimit,
+{
+    OctaneGUI::VertexBuffer Buffer;
+    Buffer.SetCompact(true);
+
+    const std::vector<OctaneGUI::Vector2> Quad({ { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } });
+    for (int I = 0; I < 20000; I++)
+    {
+        Buffer.PushCommand(6, 0, {});
+        Buffer.AddVertices(Quad, OctaneGUI::Color::White);
+        for (uint32_t Index : { 0, 1, 2, 0, 2, 3 })
+        {
+            Buffer.AddIndex(Index);
+        }
+    }
+
+    Buffer.Pack();
+    VERIFYF(Buffer.Commands().size() == 2, "Expected 2 commands, got %zu", Buffer.Commands().size());
+    VERIFY(Buffer.GetLayout().IndexSize == sizeof(uint16_t));
+
+    for (const OctaneGUI::DrawCommand& Command : Buffer.Commands())
+    {
+        VERIFY(Buffer.GetIndices()[Command.IndexOffset() + Command.IndexCount() - 1] <= UINT16_MAX);
+    }
+
+    return true;
+})
+
+TEST_CASE(AddQuads,
+{
+    // An odd count exercises both the vectorized loop and the scalar remainder.
+    const size_t Count = 7;
+    std::vector<OctaneGUI::Rect> Rects;
+    std::vector<OctaneGUI::Rect> UVs;
+    std::vector<OctaneGUI::Color> Colors;
+    for (size_t I = 0; I < Count; I++)
+    {
+        Rects.emplace_back((float)I, 1.0f, (float)I + 2.0f, 3.0f);
+        UVs.emplace_back(0.1f * (float)I, 0.2f, 0.3f, 0.4f);
+        Colors.emplace_back((uint8_t)I, 2, 3, 4);
+    }
+
+    OctaneGUI::VertexBuffer Buffer;
+    Buffer.PushCommand(6, 0, {});
+    Buffer.AddVertices(std::vector<OctaneGUI::Vector2>(4), OctaneGUI::Color::White);
+    for (uint32_t Index : { 0, 1, 2, 0, 2, 3 })
+    {
+        Buffer.AddIndex(Index);
+    }
+
+    Buffer.PushCommand((uint32_t)Count * 6, 0, {});
+    Buffer.AddQuads(Rects.data(), UVs.data(), Colors.data(), Count);
+
+    const std::vector<OctaneGUI::Vertex>& Vertices = Buffer.GetVertices();
+    const std::vector<uint32_t>& Indices = Buffer.GetIndices();
+    VERIFY(Vertices.size() == 4 + Count * 4);
+    VERIFY(Indices.size() == 6 + Count * 6);
+    VERIFY(Buffer.Commands().size() == 1);
+
+    for (size_t I = 0; I < Count; I++)
+    {
+        const OctaneGUI::Vertex* Quad = &Vertices[4 + I * 4];
+        VERIFY(Quad[0].Position == Rects[I].Min && Quad[0].TexCoords == UVs[I].Min);
+        VERIFY(Quad[1].Position == OctaneGUI::Vector2(Rects[I].Max.X, Rects[I].Min.Y));
+        VERIFY(Quad[1].TexCoords == OctaneGUI::Vector2(UVs[I].Max.X, UVs[I].Min.Y));
+        VERIFY(Quad[2].Position == Rects[I].Max && Quad[2].TexCoords == UVs[I].Max);
+        VERIFY(Quad[3].Position == OctaneGUI::Vector2(Rects[I].Min.X, Rects[I].Max.Y));
+        VERIFY(Quad[3].TexCoords == OctaneGUI::Vector2(UVs[I].Min.X, UVs[I].Max.Y));
+        VERIFY(Quad[0].Col == Colors[I] && Quad[3].Col == Colors[I]);
+
+        // Indices are rebased onto the merged command, which starts at the first quad.
+        const uint32_t Base = 4 + (uint32_t)I * 4;
+        const uint32_t* Triangles = &Indices[6 + I * 6];
+        VERIFY(Triangles[0] == Base && Triangles[1] == Base + 1 && Triangles[2] == Base + 2);
+        VERIFY(Triangles[3] == Base && Triangles[4] == Base + 2 && Triangles[5] == Base + 3);
+    }
+
+    return true;
+})
+
+)
+
+}
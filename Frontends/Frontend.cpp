@@ -106,9 +106,19 @@ OctaneGUI::Event OnEvent(OctaneGUI::Window* Window)
     return Windowing::Event(Window);
 }
 
-void OnPaint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer)
+void OnWaitEvent(int Timeout)
 {
-    Rendering::Paint(Window, Buffer);
+    Windowing::WaitEvent(Timeout);
+}
+
+void OnWake()
+{
+    Windowing::Wake();
+}
+
+void OnPaint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer, const std::vector<OctaneGUI::Rect>& Damage)
+{
+    Rendering::Paint(Window, Buffer, Damage);
 }
 
 uint32_t OnLoadTexture(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height)
@@ -169,6 +179,8 @@ void Initialize(OctaneGUI::Application& Application)
         .SetOnWindowAction(OnWindowAction)
         .SetOnNewFrame(OnNewFrame)
         .SetOnEvent(OnEvent)
+        .SetOnWaitEvent(OnWaitEvent)
+        .SetOnWake(OnWake)
         .SetOnPaint(OnPaint)
         .SetOnLoadTexture(OnLoadTexture)
         .SetOnExit(OnExit)
@@ -263,7 +263,7 @@ void DestroyRenderer(OctaneGUI::Window* Window)
 #endif
 }
 
-void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& VertexBuffer)
+void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& VertexBuffer, const std::vector<OctaneGUI::Rect>&)
 {
 	OctaneGUI::Vector2 OutputSize;
 	CAMetalLayer* Layer = GetLayer(Window, OutputSize);
@@ -57,7 +57,18 @@ namespace Frontend
 namespace Rendering
 {
 
+// Each window renders into its own framebuffer so that the contents outside of the
+// damaged regions are preserved between paints.
+struct RenderTarget
+{
+public:
+    GLuint Framebuffer { 0 };
+    GLuint Texture { 0 };
+    OctaneGUI::Vector2 Size {};
+};
+
 std::vector<GLuint> g_Textures;
+std::unordered_map<OctaneGUI::Window*, RenderTarget> g_RenderTargets;
 GLuint g_Program = 0;
 GLuint g_VertexBuffer = 0;
 GLuint g_IndexBuffer = 0;
@@ -68,6 +79,19 @@ GLint g_AttribPosition;
 GLint g_AttribUV;
 GLint g_AttribColor;
 
+// Draws VertexBuffer primitives as instanced quads shaded with a signed distance field.
+// This is only available when the instancing procedures could be loaded.
+GLuint g_PrimitiveProgram = 0;
+GLuint g_PrimitiveBuffer = 0;
+GLint g_PrimitiveUniformProjection;
+GLint g_AttribBounds;
+GLint g_AttribRadius;
+GLint g_AttribFill;
+GLint g_AttribBorder;
+GLint g_AttribBorderShadow;
+GLint g_AttribThickness;
+GLint g_AttribShape;
+
 PFNGLCREATESHADERPROC glCreateShader;
 PFNGLDELETESHADERPROC glDeleteShader;
 PFNGLSHADERSOURCEPROC glShaderSource;
@@ -98,6 +122,14 @@ PFNGLBINDVERTEXARRAYPROC glBindVertexArray;
 PFNGLDELETEVERTEXARRAYSPROC glDeleteVertexArrays;
 PFNGLDRAWELEMENTSBASEVERTEXPROC glDrawElementsBaseVertex;
 PFNGLBLENDEQUATIONPROC glBlendEquation;
+PFNGLGENFRAMEBUFFERSPROC glGenFramebuffers;
+PFNGLDELETEFRAMEBUFFERSPROC glDeleteFramebuffers;
+PFNGLBINDFRAMEBUFFERPROC glBindFramebuffer;
+PFNGLFRAMEBUFFERTEXTURE2DPROC glFramebufferTexture2D;
+PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer;
+PFNGLVERTEXATTRIBIPOINTERPROC glVertexAttribIPointer;
+PFNGLVERTEXATTRIBDIVISORPROC glVertexAttribDivisor;
+PFNGLDRAWARRAYSINSTANCEDPROC glDrawArraysInstanced;
 
 #if SDL2
     #define LOAD_PROC_ADDRESS(FnName) SDL_GL_GetProcAddress(#FnName)
@@ -109,6 +141,9 @@ PFNGLBLENDEQUATIONPROC glBlendEquation;
     FnName = (Type)LOAD_PROC_ADDRESS(FnName); \
     assert(FnName != nullptr);
 
+#define LOAD_OPTIONAL_PROCEDURE(FnName, Type) \
+    FnName = (Type)LOAD_PROC_ADDRESS(FnName);
+
 #if SDL2
 SDL_GLContext g_Context = nullptr;
 #endif
@@ -157,6 +192,34 @@ bool LinkResult(GLuint Program)
     return true;
 }
 
+GLuint CreateProgram(const GLchar* Version, const GLchar* VertexShader, const GLchar* FragmentShader)
+{
+    const GLchar* VertexShaderInfo[2] = { Version, VertexShader };
+    GLuint VertexID = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(VertexID, 2, VertexShaderInfo, nullptr);
+    glCompileShader(VertexID);
+    assert(CompileResult(VertexID));
+
+    const GLchar* FragmentShaderInfo[2] = { Version, FragmentShader };
+    GLuint FragmentID = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(FragmentID, 2, FragmentShaderInfo, nullptr);
+    glCompileShader(FragmentID);
+    assert(CompileResult(FragmentID));
+
+    GLuint Result = glCreateProgram();
+    glAttachShader(Result, VertexID);
+    glAttachShader(Result, FragmentID);
+    glLinkProgram(Result);
+    assert(LinkResult(Result));
+
+    glDetachShader(Result, VertexID);
+    glDetachShader(Result, FragmentID);
+    glDeleteShader(VertexID);
+    glDeleteShader(FragmentID);
+
+    return Result;
+}
+
 void LoadShaders()
 {
     const GLchar* Version = "#version 130\n";
@@ -185,28 +248,7 @@ void LoadShaders()
         "	Out_Color = Fragment_Color * texture(Texture, Fragment_UV.st);\n"
         "}\n";
 
-    const GLchar* VertexShaderInfo[2] = { Version, VertexShader };
-    GLuint VertexID = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(VertexID, 2, VertexShaderInfo, nullptr);
-    glCompileShader(VertexID);
-    assert(CompileResult(VertexID));
-
-    const GLchar* FragmentShaderInfo[2] = { Version, FragmentShader };
-    GLuint FragmentID = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(FragmentID, 2, FragmentShaderInfo, nullptr);
-    glCompileShader(FragmentID);
-    assert(CompileResult(FragmentID));
-
-    g_Program = glCreateProgram();
-    glAttachShader(g_Program, VertexID);
-    glAttachShader(g_Program, FragmentID);
-    glLinkProgram(g_Program);
-    assert(LinkResult(g_Program));
-
-    glDetachShader(g_Program, VertexID);
-    glDetachShader(g_Program, FragmentID);
-    glDeleteShader(VertexID);
-    glDeleteShader(FragmentID);
+    g_Program = CreateProgram(Version, VertexShader, FragmentShader);
 
     g_UniformTexture = glGetUniformLocation(g_Program, "Texture");
     g_UniformProjection = glGetUniformLocation(g_Program, "Projection");
@@ -228,6 +270,123 @@ void LoadShaders()
     assert(g_IndexBuffer != 0);
 }
 
+void LoadPrimitiveShaders()
+{
+    // Attribute divisors require OpenGL 3.3.
+    GLint Major = 0;
+    GLint Minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &Major);
+    glGetIntegerv(GL_MINOR_VERSION, &Minor);
+    if (Major * 10 + Minor < 33)
+    {
+        return;
+    }
+
+    if (glVertexAttribIPointer == nullptr || glVertexAttribDivisor == nullptr || glDrawArraysInstanced == nullptr)
+    {
+        return;
+    }
+
+    const GLchar* Version = "#version 130\n";
+
+    const GLchar* VertexShader =
+        "uniform mat4 Projection;\n"
+        "in vec4 Bounds;\n"
+        "in vec4 Radius;\n"
+        "in vec4 Fill;\n"
+        "in vec4 Border;\n"
+        "in vec4 BorderShadow;\n"
+        "in float Thickness;\n"
+        "in uint Shape;\n"
+        "out vec2 Local;\n"
+        "flat out vec2 HalfSize;\n"
+        "flat out vec4 Radii;\n"
+        "flat out vec4 FillColor;\n"
+        "flat out vec4 BorderColor;\n"
+        "flat out vec4 ShadowColor;\n"
+        "flat out float BorderThickness;\n"
+        "void main()\n"
+        "{\n"
+        "	vec2 Corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1)) * 2.0 - 1.0;\n"
+        "	vec2 Center = (Bounds.xy + Bounds.zw) * 0.5;\n"
+        "	vec2 AxisX = vec2(1.0, 0.0);\n"
+        "	HalfSize = abs(Bounds.zw - Bounds.xy) * 0.5;\n"
+        "	Radii = Radius;\n"
+        "	BorderThickness = Thickness;\n"
+        "	if (Shape == 1u)\n"
+        "	{\n"
+        "		vec2 Delta = Bounds.zw - Bounds.xy;\n"
+        "		float Length = length(Delta);\n"
+        "		AxisX = Length > 0.0 ? Delta / Length : vec2(1.0, 0.0);\n"
+        "		HalfSize = vec2(Length * 0.5, Thickness * 0.5);\n"
+        "		Radii = vec4(0.0);\n"
+        "		BorderThickness = 0.0;\n"
+        "	}\n"
+        "	vec2 AxisY = vec2(-AxisX.y, AxisX.x);\n"
+        "	Local = Corner * (HalfSize + 1.0);\n"
+        "	FillColor = Fill;\n"
+        "	BorderColor = Border;\n"
+        "	ShadowColor = BorderShadow;\n"
+        "	gl_Position = Projection * vec4(Center + AxisX * Local.x + AxisY * Local.y, 0, 1);\n"
+        "}\n";
+
+    const GLchar* FragmentShader =
+        "in vec2 Local;\n"
+        "flat in vec2 HalfSize;\n"
+        "flat in vec4 Radii;\n"
+        "flat in vec4 FillColor;\n"
+        "flat in vec4 BorderColor;\n"
+        "flat in vec4 ShadowColor;\n"
+        "flat in float BorderThickness;\n"
+        "out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "	float R = Local.x < 0.0 ? (Local.y < 0.0 ? Radii.x : Radii.z) : (Local.y < 0.0 ? Radii.y : Radii.w);\n"
+        "	R = min(R, min(HalfSize.x, HalfSize.y));\n"
+        "	vec2 Q = abs(Local) - HalfSize + R;\n"
+        "	float Distance = length(max(Q, 0.0)) + min(max(Q.x, Q.y), 0.0) - R;\n"
+        "	float Coverage = clamp(0.5 - Distance, 0.0, 1.0);\n"
+        "	vec4 Color = FillColor;\n"
+        "	if (BorderThickness > 0.0)\n"
+        "	{\n"
+        "		vec2 Normal = max(Q, 0.0);\n"
+        "		if (Normal.x == 0.0 && Normal.y == 0.0)\n"
+        "		{\n"
+        "			Normal = Q.x > Q.y ? vec2(1.0, 0.0) : vec2(0.0, 1.0);\n"
+        "		}\n"
+        "		Normal *= sign(Local);\n"
+        "		vec4 Edge = Normal.x + Normal.y < 0.0 ? BorderColor : ShadowColor;\n"
+        "		Color = mix(Edge, FillColor, clamp(0.5 - (Distance + BorderThickness), 0.0, 1.0));\n"
+        "	}\n"
+        "	Out_Color = vec4(Color.rgb, Color.a * Coverage);\n"
+        "}\n";
+
+    g_PrimitiveProgram = CreateProgram(Version, VertexShader, FragmentShader);
+
+    g_PrimitiveUniformProjection = glGetUniformLocation(g_PrimitiveProgram, "Projection");
+    g_AttribBounds = glGetAttribLocation(g_PrimitiveProgram, "Bounds");
+    g_AttribRadius = glGetAttribLocation(g_PrimitiveProgram, "Radius");
+    g_AttribFill = glGetAttribLocation(g_PrimitiveProgram, "Fill");
+    g_AttribBorder = glGetAttribLocation(g_PrimitiveProgram, "Border");
+    g_AttribBorderShadow = glGetAttribLocation(g_PrimitiveProgram, "BorderShadow");
+    g_AttribThickness = glGetAttribLocation(g_PrimitiveProgram, "Thickness");
+    g_AttribShape = glGetAttribLocation(g_PrimitiveProgram, "Shape");
+
+    glGenBuffers(1, &g_PrimitiveBuffer);
+
+    assert(g_PrimitiveUniformProjection != -1);
+    assert(g_AttribBounds != -1);
+    assert(g_AttribRadius != -1);
+    assert(g_AttribFill != -1);
+    assert(g_AttribBorder != -1);
+    assert(g_AttribBorderShadow != -1);
+    assert(g_AttribThickness != -1);
+    assert(g_AttribShape != -1);
+
+    assert(g_PrimitiveProgram != 0);
+    assert(g_PrimitiveBuffer != 0);
+}
+
 void LoadProcedures()
 {
     LOAD_PROCEDURE(glCreateShader, PFNGLCREATESHADERPROC);
@@ -260,6 +419,111 @@ void LoadProcedures()
     LOAD_PROCEDURE(glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC);
     LOAD_PROCEDURE(glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC);
     LOAD_PROCEDURE(glBlendEquation, PFNGLBLENDEQUATIONPROC);
+    LOAD_PROCEDURE(glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC);
+    LOAD_PROCEDURE(glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC);
+    LOAD_PROCEDURE(glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC);
+    LOAD_PROCEDURE(glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC);
+    LOAD_PROCEDURE(glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC);
+    LOAD_OPTIONAL_PROCEDURE(glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC);
+    LOAD_OPTIONAL_PROCEDURE(glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC);
+    LOAD_OPTIONAL_PROCEDURE(glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC);
+}
+
+void DestroyRenderTarget(RenderTarget& Target)
+{
+    if (Target.Framebuffer != 0)
+    {
+        glDeleteFramebuffers(1, &Target.Framebuffer);
+        Target.Framebuffer = 0;
+    }
+
+    if (Target.Texture != 0)
+    {
+        glDeleteTextures(1, &Target.Texture);
+        Target.Texture = 0;
+    }
+}
+
+// Returns true if the target was (re)created, which means its contents are undefined.
+bool UpdateRenderTarget(RenderTarget& Target, const OctaneGUI::Vector2& Size)
+{
+    if (Target.Framebuffer != 0 && Target.Size == Size)
+    {
+        return false;
+    }
+
+    DestroyRenderTarget(Target);
+    Target.Size = Size;
+
+    GLint Current = 0;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &Current);
+
+    glGenTextures(1, &Target.Texture);
+    glBindTexture(GL_TEXTURE_2D, Target.Texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, (GLsizei)Size.X, (GLsizei)Size.Y, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindTexture(GL_TEXTURE_2D, Current);
+
+    glGenFramebuffers(1, &Target.Framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, Target.Framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, Target.Texture, 0);
+
+    return true;
+}
+
+void SetAttribute(GLint Location, const OctaneGUI::VertexLayout::Attribute& Attribute, uint32_t Stride)
+{
+    GLint Size = 2;
+    GLenum Type = GL_FLOAT;
+    GLboolean Normalized = GL_FALSE;
+
+    switch (Attribute.Type)
+    {
+    case OctaneGUI::VertexLayout::Format::Short2: Type = GL_SHORT; break;
+    case OctaneGUI::VertexLayout::Format::UShort2Norm:
+        Type = GL_UNSIGNED_SHORT;
+        Normalized = GL_TRUE;
+        break;
+    case OctaneGUI::VertexLayout::Format::UByte4Norm:
+        Size = 4;
+        Type = GL_UNSIGNED_BYTE;
+        Normalized = GL_TRUE;
+        break;
+    case OctaneGUI::VertexLayout::Format::Float2:
+    default: break;
+    }
+
+    glEnableVertexAttribArray(Location);
+    glVertexAttribPointer(Location, Size, Type, Normalized, (GLsizei)Stride, (GLvoid*)(size_t)Attribute.Offset);
+}
+
+void SetInstanceAttribute(GLint Location, GLint Size, GLenum Type, GLboolean Normalized, size_t Offset)
+{
+    glEnableVertexAttribArray(Location);
+    if (Type == GL_UNSIGNED_INT)
+    {
+        glVertexAttribIPointer(Location, Size, Type, sizeof(OctaneGUI::Primitive), (GLvoid*)Offset);
+    }
+    else
+    {
+        glVertexAttribPointer(Location, Size, Type, Normalized, sizeof(OctaneGUI::Primitive), (GLvoid*)Offset);
+    }
+    glVertexAttribDivisor(Location, 1);
+}
+
+// Points the instance attributes at the given primitive so that instance 0 of the next
+// draw call reads it.
+void SetPrimitiveAttributes(uint32_t First)
+{
+    const size_t Base = (size_t)First * sizeof(OctaneGUI::Primitive);
+    SetInstanceAttribute(g_AttribBounds, 4, GL_FLOAT, GL_FALSE, Base + offsetof(OctaneGUI::Primitive, Bounds));
+    SetInstanceAttribute(g_AttribRadius, 4, GL_FLOAT, GL_FALSE, Base + offsetof(OctaneGUI::Primitive, Radius));
+    SetInstanceAttribute(g_AttribFill, 4, GL_UNSIGNED_BYTE, GL_TRUE, Base + offsetof(OctaneGUI::Primitive, Fill));
+    SetInstanceAttribute(g_AttribBorder, 4, GL_UNSIGNED_BYTE, GL_TRUE, Base + offsetof(OctaneGUI::Primitive, Border));
+    SetInstanceAttribute(g_AttribBorderShadow, 4, GL_UNSIGNED_BYTE, GL_TRUE, Base + offsetof(OctaneGUI::Primitive, BorderShadow));
+    SetInstanceAttribute(g_AttribThickness, 1, GL_FLOAT, GL_FALSE, Base + offsetof(OctaneGUI::Primitive, Thickness));
+    SetInstanceAttribute(g_AttribShape, 1, GL_UNSIGNED_INT, GL_FALSE, Base + offsetof(OctaneGUI::Primitive, Shape));
 }
 
 void Initialize()
@@ -305,17 +569,27 @@ void CreateRenderer(OctaneGUI::Window* Window)
     {
         LoadProcedures();
         LoadShaders();
+        LoadPrimitiveShaders();
 
         std::vector<uint8_t> Texture { 255, 255, 255, 255 };
         g_DefaultTexture = LoadTexture(Texture, 1, 1);
     }
+
+    Window->SetPartialRepaint(true);
+    Window->SetPrimitiveRendering(g_PrimitiveProgram != 0);
 }
 
-void DestroyRenderer(OctaneGUI::Window*)
+void DestroyRenderer(OctaneGUI::Window* Window)
 {
+    auto It = g_RenderTargets.find(Window);
+    if (It != g_RenderTargets.end())
+    {
+        DestroyRenderTarget(It->second);
+        g_RenderTargets.erase(It);
+    }
 }
 
-void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer)
+void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer, const std::vector<OctaneGUI::Rect>& Damage)
 {
 #if SDL2
     SDL_Window* Instance = Windowing::Get(Window);
@@ -325,8 +599,15 @@ void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer)
     const OctaneGUI::Vector2 Size = Window->GetSize();
     glViewport(0, 0, (int)Size.X, (int)Size.Y);
 
+    RenderTarget& Target = g_RenderTargets[Window];
+    std::vector<OctaneGUI::Rect> Regions = Damage;
+    if (UpdateRenderTarget(Target, Size) || Regions.empty())
+    {
+        Regions.assign(1, { OctaneGUI::Vector2::Zero, Size });
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, Target.Framebuffer);
     glClearColor(0, 0, 0, 255);
-    glClear(GL_COLOR_BUFFER_BIT);
 
     GLuint VertexArrayObject = 0;
     glGenVertexArrays(1, &VertexArrayObject);
@@ -343,13 +624,35 @@ void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer)
     float R = Size.X;
     float T = 0.0f;
     float B = Size.Y;
+    // Packed positions are scaled back to pixels by the projection.
+    const float Scale = Buffer.GetLayout().PositionScale;
     const float Projection[4][4] = {
-        { 2.0f / (R - L), 0.0f, 0.0f, 0.0f },
-        { 0.0f, 2.0f / (T - B), 0.0f, 0.0f },
+        { 2.0f / (R - L) * Scale, 0.0f, 0.0f, 0.0f },
+        { 0.0f, 2.0f / (T - B) * Scale, 0.0f, 0.0f },
         { 0.0f, 0.0f, -1.0f, 0.0f },
         { (R + L) / (L - R), (T + B) / (B - T), 0.0f, 1.0f }
     };
 
+    const std::vector<OctaneGUI::Primitive>& Primitives = Buffer.GetPrimitives();
+    GLuint PrimitiveArrayObject = 0;
+    if (!Primitives.empty() && g_PrimitiveProgram != 0)
+    {
+        const float PrimitiveProjection[4][4] = {
+            { 2.0f / (R - L), 0.0f, 0.0f, 0.0f },
+            { 0.0f, 2.0f / (T - B), 0.0f, 0.0f },
+            { 0.0f, 0.0f, -1.0f, 0.0f },
+            { (R + L) / (L - R), (T + B) / (B - T), 0.0f, 1.0f }
+        };
+
+        glUseProgram(g_PrimitiveProgram);
+        glUniformMatrix4fv(g_PrimitiveUniformProjection, 1, GL_FALSE, &PrimitiveProjection[0][0]);
+
+        glGenVertexArrays(1, &PrimitiveArrayObject);
+        glBindVertexArray(PrimitiveArrayObject);
+        glBindBuffer(GL_ARRAY_BUFFER, g_PrimitiveBuffer);
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(Primitives.size() * sizeof(OctaneGUI::Primitive)), Primitives.data(), GL_STREAM_DRAW);
+    }
+
     glUseProgram(g_Program);
     glUniform1i(g_UniformTexture, 0);
     glUniformMatrix4fv(g_UniformProjection, 1, GL_FALSE, &Projection[0][0]);
@@ -358,45 +661,78 @@ void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer)
 
     glBindBuffer(GL_ARRAY_BUFFER, g_VertexBuffer);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_IndexBuffer);
-    glEnableVertexAttribArray(g_AttribPosition);
-    glEnableVertexAttribArray(g_AttribUV);
-    glEnableVertexAttribArray(g_AttribColor);
-    glVertexAttribPointer(g_AttribPosition, 2, GL_FLOAT, GL_FALSE, sizeof(OctaneGUI::Vertex), (GLvoid*)offsetof(OctaneGUI::Vertex, Position));
-    glVertexAttribPointer(g_AttribUV, 2, GL_FLOAT, GL_FALSE, sizeof(OctaneGUI::Vertex), (GLvoid*)offsetof(OctaneGUI::Vertex, TexCoords));
-    glVertexAttribPointer(g_AttribColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(OctaneGUI::Vertex), (GLvoid*)offsetof(OctaneGUI::Vertex, Col));
+    const OctaneGUI::VertexLayout& Layout = Buffer.GetLayout();
+    SetAttribute(g_AttribPosition, Layout.Position, Layout.Stride);
+    SetAttribute(g_AttribUV, Layout.TexCoords, Layout.Stride);
+    SetAttribute(g_AttribColor, Layout.Col, Layout.Stride);
 
-    const std::vector<OctaneGUI::Vertex>& Vertices = Buffer.GetVertices();
-    const std::vector<uint32_t>& Indices = Buffer.GetIndices();
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)Buffer.GetVertexDataSize(), Buffer.GetVertexData(), GL_STREAM_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)Buffer.GetIndexDataSize(), Buffer.GetIndexData(), GL_STREAM_DRAW);
 
-    const GLsizeiptr VertexBufferSize = (GLsizeiptr)(Vertices.size() * sizeof(OctaneGUI::Vertex));
-    const GLsizeiptr IndexBufferSize = (GLsizeiptr)(Indices.size() * sizeof(uint32_t));
+    const GLenum IndexType = Layout.IndexSize == sizeof(uint16_t) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
 
-    glBufferData(GL_ARRAY_BUFFER, VertexBufferSize, Vertices.data(), GL_STREAM_DRAW);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, IndexBufferSize, Indices.data(), GL_STREAM_DRAW);
-
-    for (const OctaneGUI::DrawCommand& Command : Buffer.Commands())
+    // Only the damaged regions are cleared and redrawn. Everything else is kept from the last paint.
+    for (const OctaneGUI::Rect& Region : Regions)
     {
-        OctaneGUI::Rect Scissor { OctaneGUI::Vector2::Zero, Size };
-        const OctaneGUI::Rect Clip = Command.Clip();
-        if (!Clip.IsZero())
-        {
-            Scissor = Clip;
-        }
-        glScissor((GLint)Scissor.Min.X, (GLint)(Size.Y - Scissor.Max.Y), (GLsizei)Scissor.Width(), (GLsizei)Scissor.Height());
+        glScissor((GLint)Region.Min.X, (GLint)(Size.Y - Region.Max.Y), (GLsizei)Region.Width(), (GLsizei)Region.Height());
+        glClear(GL_COLOR_BUFFER_BIT);
 
-        if (Command.TextureID() == 0)
-        {
-            glBindTexture(GL_TEXTURE_2D, g_DefaultTexture);
-        }
-        else
+        for (const OctaneGUI::DrawCommand& Command : Buffer.Commands())
         {
-            glBindTexture(GL_TEXTURE_2D, Command.TextureID());
+            OctaneGUI::Rect Scissor = Region;
+            const OctaneGUI::Rect Clip = Command.Clip();
+            if (!Clip.IsZero())
+            {
+                Scissor = Clip.Intersection(Region);
+            }
+
+            if (Scissor.Width() <= 0.0f || Scissor.Height() <= 0.0f)
+            {
+                continue;
+            }
+
+            glScissor((GLint)Scissor.Min.X, (GLint)(Size.Y - Scissor.Max.Y), (GLsizei)Scissor.Width(), (GLsizei)Scissor.Height());
+
+            if (Command.IsPrimitive())
+            {
+                if (PrimitiveArrayObject != 0)
+                {
+                    glUseProgram(g_PrimitiveProgram);
+                    glBindVertexArray(PrimitiveArrayObject);
+                    glBindBuffer(GL_ARRAY_BUFFER, g_PrimitiveBuffer);
+                    SetPrimitiveAttributes(Command.PrimitiveOffset());
+                    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)Command.PrimitiveCount());
+                    glUseProgram(g_Program);
+                    glBindVertexArray(VertexArrayObject);
+                }
+
+                continue;
+            }
+
+            if (Command.TextureID() == 0)
+            {
+                glBindTexture(GL_TEXTURE_2D, g_DefaultTexture);
+            }
+            else
+            {
+                glBindTexture(GL_TEXTURE_2D, Command.TextureID());
+            }
+
+            glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)Command.IndexCount(), IndexType, (void*)((size_t)Command.IndexOffset() * Layout.IndexSize), (GLint)Command.VertexOffset());
         }
-
-        glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)Command.IndexCount(), GL_UNSIGNED_INT, (void*)(Command.IndexOffset() * sizeof(uint32_t)), (GLint)Command.VertexOffset());
     }
 
     glDeleteVertexArrays(1, &VertexArrayObject);
+    if (PrimitiveArrayObject != 0)
+    {
+        glDeleteVertexArrays(1, &PrimitiveArrayObject);
+    }
+
+    glDisable(GL_SCISSOR_TEST);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, Target.Framebuffer);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    glBlitFramebuffer(0, 0, (GLint)Size.X, (GLint)Size.Y, 0, 0, (GLint)Size.X, (GLint)Size.Y, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
 #if SDL2
     SDL_GL_SwapWindow(Instance);
@@ -441,9 +777,27 @@ void Exit()
         g_Program = 0;
     }
 
+    if (g_PrimitiveBuffer != 0)
+    {
+        glDeleteBuffers(1, &g_PrimitiveBuffer);
+        g_PrimitiveBuffer = 0;
+    }
+
+    if (g_PrimitiveProgram != 0)
+    {
+        glDeleteProgram(g_PrimitiveProgram);
+        g_PrimitiveProgram = 0;
+    }
+
     glDeleteTextures((GLsizei)g_Textures.size(), g_Textures.data());
     g_Textures.clear();
 
+    for (std::pair<OctaneGUI::Window* const, RenderTarget>& Item : g_RenderTargets)
+    {
+        DestroyRenderTarget(Item.second);
+    }
+    g_RenderTargets.clear();
+
 #if SDL2
     if (g_Context != nullptr)
     {
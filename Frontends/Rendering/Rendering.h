@@ -32,6 +32,7 @@ SOFTWARE.
 namespace OctaneGUI
 {
 
+struct Rect;
 class Window;
 class VertexBuffer;
 
@@ -45,7 +46,7 @@ namespace Rendering
 void Initialize();
 void CreateRenderer(OctaneGUI::Window* Window);
 void DestroyRenderer(OctaneGUI::Window* Window);
-void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer);
+void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer, const std::vector<OctaneGUI::Rect>& Damage);
 uint32_t LoadTexture(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height);
 void Exit();
 
@@ -50,7 +50,7 @@ void DestroyRenderer(OctaneGUI::Window*)
 {
 }
 
-void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer)
+void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer, const std::vector<OctaneGUI::Rect>&)
 {
     const std::shared_ptr<sf::RenderWindow>& RenderWindow = Windowing::Get(Window);
 
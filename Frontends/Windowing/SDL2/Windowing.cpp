@@ -41,6 +41,7 @@ SOFTWARE.
     #include "../Mac/Windowing.h"
 #endif
 
+#include <algorithm>
 #include <unordered_map>
 
 namespace Frontend
@@ -51,6 +52,7 @@ namespace Windowing
 static std::unordered_map<OctaneGUI::Window*, SDL_Window*> g_Windows;
 static std::unordered_map<uint32_t, std::vector<SDL_Event>> g_UnhandledEvents {};
 static std::unordered_map<SDL_SystemCursor, SDL_Cursor*> g_SystemCursors {};
+static uint32_t g_WakeEvent { (uint32_t)-1 };
 
 OctaneGUI::Keyboard::Key GetKey(SDL_Keycode Code)
 {
@@ -139,6 +141,19 @@ void* NativeHandle(SDL_Window* Window)
 #endif
 }
 
+bool IsWindowID(const uint32_t ID)
+{
+    for (const std::pair<OctaneGUI::Window*, SDL_Window*> Item : g_Windows)
+    {
+        if (SDL_GetWindowID(Item.second) == ID)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 // Events in SDL have an associated window ID for which the event is tied to. With multiple windows,
 // this ID may not match the window that is pumping the events. If the IDs do not match, the event
 // is added to a queue for the appropriate window.
@@ -163,6 +178,13 @@ bool AddUnhandledEvent(SDL_Event& Event, const uint32_t EventWindowID, const uin
     // If the event does not match the target window, then we must queue it.
     else if (EventWindowID != WindowID)
     {
+        // Events for windows that were already destroyed are dropped, since no window will
+        // ever handle them.
+        if (!IsWindowID(EventWindowID))
+        {
+            return false;
+        }
+
         std::vector<SDL_Event>& Events = g_UnhandledEvents[EventWindowID];
         Events.push_back(Event);
         // This event is not meant for the target window. Should not continue processing.
@@ -326,6 +348,14 @@ OctaneGUI::Event HandleEvent(SDL_Event& Event, const uint32_t WindowID, bool IsP
     return OctaneGUI::Event(OctaneGUI::Event::Type::None);
 }
 
+// SDL stamps events in milliseconds since initialization when they are received from the OS.
+// Convert that to the clock used by OctaneGUI events.
+int64_t ReceivedTimestamp(const SDL_Event& Event)
+{
+    const int64_t Age = (int64_t)(SDL_GetTicks() - Event.common.timestamp);
+    return OctaneGUI::Clock::Timestamp() - std::max<int64_t>(Age, 0) * 1000;
+}
+
 SDL_HitTestResult SDLCALL OnHitTest(SDL_Window* Window, SDL_Point* Area, void*)
 {
     OctaneGUI::Window* Target { nullptr };
@@ -394,6 +424,9 @@ bool Initialize(OctaneGUI::Application& Application)
     SDL_GetVersion(&Version);
     printf("Using SDL version %d.%d.%d\n", Version.major, Version.minor, Version.patch);
 
+    // Pushed from other threads to wake up WaitEvent. The event is otherwise ignored.
+    g_WakeEvent = SDL_RegisterEvents(1);
+
     g_SystemCursors[SDL_SYSTEM_CURSOR_ARROW] = SDL_CreateSystemCursor(SDL_SYSTEM_CURSOR_ARROW);
     g_SystemCursors[SDL_SYSTEM_CURSOR_IBEAM] = SDL_CreateSystemCursor(SDL_SYSTEM_CURSOR_IBEAM);
     g_SystemCursors[SDL_SYSTEM_CURSOR_SIZEWE] = SDL_CreateSystemCursor(SDL_SYSTEM_CURSOR_SIZEWE);
@@ -644,7 +677,7 @@ OctaneGUI::Event Event(OctaneGUI::Window* Window)
         OctaneGUI::Event Processed = HandleEvent(Event, WindowID, false);
         if (Processed.GetType() != OctaneGUI::Event::Type::None)
         {
-            return Processed;
+            return Processed.SetTimestamp(ReceivedTimestamp(Event));
         }
     }
 
@@ -654,13 +687,49 @@ OctaneGUI::Event Event(OctaneGUI::Window* Window)
         OctaneGUI::Event Processed = HandleEvent(Event, WindowID, true);
         if (Processed.GetType() != OctaneGUI::Event::Type::None)
         {
-            return Processed;
+            return Processed.SetTimestamp(ReceivedTimestamp(Event));
         }
     }
 
     return OctaneGUI::Event(OctaneGUI::Event::Type::None);
 }
 
+void WaitEvent(int Timeout)
+{
+    // Events queued for another window are handled in the next frame. Only queues of live
+    // windows are drained, so any others must not keep the application awake.
+    for (const std::pair<OctaneGUI::Window*, SDL_Window*> Item : g_Windows)
+    {
+        std::unordered_map<uint32_t, std::vector<SDL_Event>>::const_iterator It = g_UnhandledEvents.find(SDL_GetWindowID(Item.second));
+        if (It != g_UnhandledEvents.end() && !It->second.empty())
+        {
+            return;
+        }
+    }
+
+    // Passing a null event leaves the event in the queue to be handled by the next frame.
+    if (Timeout < 0)
+    {
+        SDL_WaitEvent(nullptr);
+    }
+    else
+    {
+        SDL_WaitEventTimeout(nullptr, Timeout);
+    }
+}
+
+void Wake()
+{
+    if (g_WakeEvent == (uint32_t)-1)
+    {
+        return;
+    }
+
+    SDL_Event Event {};
+    Event.type = g_WakeEvent;
+    SDL_PushEvent(&Event);
+}
+
 void Exit()
 {
     for (const std::pair<SDL_SystemCursor, SDL_Cursor*> SystemCursor : g_SystemCursors)
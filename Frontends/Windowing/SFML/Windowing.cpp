@@ -29,6 +29,7 @@ SOFTWARE.
 #include "OctaneGUI/OctaneGUI.h"
 #include "SFML/Graphics.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 
@@ -394,6 +395,22 @@ OctaneGUI::Event Event(OctaneGUI::Window* Window)
     return OctaneGUI::Event(OctaneGUI::Event::Type::None);
 }
 
+void WaitEvent(int Timeout)
+{
+    // SFML can only wait on a single window without a timeout, so events are polled at a fixed
+    // interval instead.
+    const int Interval = 10;
+    if (Timeout != 0)
+    {
+        sf::sleep(sf::milliseconds(Timeout < 0 ? Interval : std::min<int>(Timeout, Interval)));
+    }
+}
+
+void Wake()
+{
+    // WaitEvent never blocks for longer than its polling interval.
+}
+
 void Exit()
 {
     for (const std::pair<OctaneGUI::Window*, std::shared_ptr<sf::RenderWindow>> Item : g_Windows)
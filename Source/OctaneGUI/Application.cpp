@@ -32,7 +32,6 @@ SOFTWARE.
 #include "Event.h"
 #include "Icons.h"
 #include "Json.h"
-#include "Paint.h"
 #include "Profiler.h"
 #include "Texture.h"
 #include "Theme.h"
@@ -45,12 +44,18 @@ SOFTWARE.
 
 #include <algorithm>
 #include <chrono>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <sstream>
 #include <thread>
 
 namespace OctaneGUI
 {
 
+// Interval used to poll when the frontend cannot wait for events.
+#define IDLE_SLEEP_MS 10
+
 Application::Application()
 {
     Texture::SetOnLoad([this](const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height) -> uint32_t
@@ -98,7 +103,15 @@ bool Application::Initialize(const char* JsonStream, std::unordered_map<std::str
         return false;
     }
 
+    const std::string ReplayPath = m_CommandLine.Get("--replay");
+    if (!ReplayPath.empty() && !Replay(ReplayPath.c_str()))
+    {
+        printf("Failed to load replay '%s'\n", ReplayPath.c_str());
+    }
+
     m_HighDPI = Root["HighDPI"].Boolean(m_HighDPI);
+    m_FrameBudget = (int)Root["FrameBudget"].Number((float)m_FrameBudget);
+    m_ParallelPaint = Root["ParallelPaint"].Boolean(m_ParallelPaint);
     m_CustomTitleBar = Root["CustomTitleBar"].Boolean(m_CustomTitleBar);
 
     // First, create and load base settings for each defined window.
@@ -131,6 +144,7 @@ bool Application::Initialize(const char* JsonStream, std::unordered_map<std::str
     Assert(m_Theme->GetFont() != nullptr, "No font loaded with theme!");
 
     m_FileSystem.SetUseSystemFileDialog(Root["UseSystemFileDialog"].Boolean());
+    m_Jobs.Initialize(m_CommandLine.GetInt("--jobs", -1));
 
     if (Root["UseNetwork"].Boolean())
     {
@@ -156,11 +170,30 @@ bool Application::Initialize(const char* JsonStream, std::unordered_map<std::str
     m_Tools = std::make_shared<Tools::Interface>();
 #endif // TOOLS
 
+    const std::string RecordPath = m_CommandLine.Get("--record");
+    if (!RecordPath.empty() && !StartRecording(RecordPath.c_str()))
+    {
+        printf("Failed to open recording '%s'\n", RecordPath.c_str());
+    }
+
+    if (m_Player.IsLoaded())
+    {
+        m_Player.Start();
+        m_ReplayFrames = 0;
+    }
+
     return true;
 }
 
 void Application::Shutdown()
 {
+    if (m_CommandLine.Has("--latency"))
+    {
+        PrintInputLatency();
+    }
+
+    m_Jobs.Shutdown();
+    m_Recorder.Close();
     m_LanguageServer.Shutdown();
     m_Network.Shutdown();
 
@@ -184,20 +217,56 @@ void Application::Update()
 {
     m_LanguageServer.Process();
 
+    Clock Phase;
     for (auto& Item : m_Windows)
     {
         if (Item.second->IsVisible())
         {
-            Item.second->Update();
+            if (m_FrameBudget > 0)
+            {
+                Item.second->Update(std::max<float>((float)m_FrameBudget - m_FrameClock.Measure() * 1000.0f, 0.0f));
+            }
+            else
+            {
+                Item.second->Update();
+            }
+        }
+    }
+
+    m_FrameTimings.Layout = Phase.Measure() * 1000.0f;
+    Phase.Reset();
+
+    if (!PaintParallel())
+    {
+        bool Painted = false;
+        for (auto& Item : m_Windows)
+        {
+            if (Item.second->IsVisible())
+            {
+                if (m_FrameBudget > 0 && Painted && m_FrameClock.Measure() * 1000.0f >= (float)m_FrameBudget)
+                {
+                    break;
+                }
+
+                Painted |= Item.second->NeedsRepaint();
+                Item.second->DoPaint();
+            }
         }
     }
 
+    m_FrameTimings.Paint = Phase.Measure() * 1000.0f;
+
+    m_FrameTimings.Deferred = 0;
     for (auto& Item : m_Windows)
     {
-        if (Item.second->IsVisible())
+        if (Item.second->IsVisible() && Item.second->NeedsUpdate())
         {
-            Paint Brush(m_Theme);
-            Item.second->DoPaint(Brush);
+            m_FrameTimings.Deferred++;
+        }
+        else
+        {
+            // Input that did not change anything has nothing to present.
+            Item.second->ClearUnpaintedInput();
         }
     }
 
@@ -218,10 +287,19 @@ int Application::Run()
         {
             const int EventsProcessed { RunFrame() };
 
-            if (EventsProcessed <= 0)
+            if (EventsProcessed <= 0 && m_IsRunning)
             {
-                PROFILER_SAMPLE("Sleep");
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                PROFILER_SAMPLE("Wait");
+                const int Timeout = WaitTimeout();
+                if (m_OnWaitEvent)
+                {
+                    m_OnWaitEvent(Timeout);
+                }
+                else if (Timeout != 0)
+                {
+                    const int Sleep = Timeout < 0 ? IDLE_SLEEP_MS : std::min<int>(Timeout, IDLE_SLEEP_MS);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(Sleep));
+                }
             }
         }
     }
@@ -239,6 +317,10 @@ int Application::RunFrame()
 
     PROFILER_FRAME();
 
+    m_FrameClock.Reset();
+
+    m_DispatchQueue.Run();
+
     if (m_OnNewFrame)
     {
         m_OnNewFrame();
@@ -247,17 +329,7 @@ int Application::RunFrame()
     int EventsProcessed = 0;
     for (auto& Item : m_Windows)
     {
-        // Attempt to process all events for a single window.
-        while (Item.second->IsVisible())
-        {
-            int Processed = ProcessEvent(Item.second);
-            EventsProcessed += Processed;
-
-            if (Processed == 0)
-            {
-                break;
-            }
-        }
+        EventsProcessed += ProcessEvents(Item.second);
 
         if (!m_IsRunning)
         {
@@ -266,11 +338,181 @@ int Application::RunFrame()
         }
     }
 
+    if (m_Player.IsLoaded())
+    {
+        m_Player.SkipUnavailable([this](const char* ID) -> bool
+            {
+                const auto It = m_Windows.find(ID);
+                return It != m_Windows.end() && It->second->IsVisible();
+            });
+    }
+
+    m_FrameTimings.Events = m_FrameClock.Measure() * 1000.0f;
+
     Update();
 
+    if (m_Player.IsLoaded())
+    {
+        m_ReplayFrames++;
+
+        if (m_Player.IsFinished())
+        {
+            printf("Replayed %zu events over %u frames in %.3f seconds.\n", m_Player.Played(), m_ReplayFrames, m_Player.Elapsed());
+            PrintInputLatency();
+            Quit();
+        }
+    }
+
     return EventsProcessed;
 }
 
+uint32_t Application::CoalescedEvents() const
+{
+    return m_CoalescedEvents;
+}
+
+Application& Application::SetFrameBudget(int Milliseconds)
+{
+    m_FrameBudget = Milliseconds;
+    return *this;
+}
+
+int Application::FrameBudget() const
+{
+    return m_FrameBudget;
+}
+
+Application& Application::SetParallelPaint(bool ParallelPaint)
+{
+    m_ParallelPaint = ParallelPaint;
+    return *this;
+}
+
+bool Application::ParallelPaint() const
+{
+    return m_ParallelPaint;
+}
+
+Application& Application::Post(DispatchQueue::OnDispatchSignature&& Fn)
+{
+    m_DispatchQueue.Push(std::move(Fn));
+
+    if (m_OnWake)
+    {
+        m_OnWake();
+    }
+
+    return *this;
+}
+
+bool Application::StartRecording(const char* Path)
+{
+    return m_Recorder.Open(Path);
+}
+
+void Application::StopRecording()
+{
+    m_Recorder.Close();
+}
+
+bool Application::IsRecording() const
+{
+    return m_Recorder.IsOpen();
+}
+
+bool Application::Replay(const char* Path)
+{
+    if (!m_Player.Load(Path))
+    {
+        return false;
+    }
+
+    // Detach from the frontend so that no system windows are needed.
+    m_OnWindowAction = nullptr;
+    m_OnPaint = nullptr;
+    m_OnWaitEvent = nullptr;
+    m_OnWake = nullptr;
+    m_OnSetWindowTitle = nullptr;
+    m_OnSetMouseCursor = nullptr;
+    m_OnSetMousePosition = nullptr;
+
+    // Textures only need unique IDs since nothing is rendered.
+    m_OnLoadTexture = [TextureID = 0u](const std::vector<uint8_t>&, uint32_t, uint32_t) mutable -> uint32_t
+    {
+        return ++TextureID;
+    };
+
+    m_OnEvent = [this](Window* Target) -> Event
+    {
+        return m_Player.Next(Target->ID());
+    };
+
+    m_Player.Start();
+    m_ReplayFrames = 0;
+    return true;
+}
+
+bool Application::IsReplaying() const
+{
+    return m_Player.IsLoaded();
+}
+
+const Histogram& Application::InputLatency() const
+{
+    return m_InputLatency;
+}
+
+Histogram& Application::InputLatency()
+{
+    return m_InputLatency;
+}
+
+const Application::FrameTimings& Application::GetFrameTimings() const
+{
+    return m_FrameTimings;
+}
+
+int Application::WaitTimeout() const
+{
+    // Work carried over from a frame that exceeded its budget must run without waiting.
+    if (m_FrameTimings.Deferred > 0 || !m_DispatchQueue.IsEmpty())
+    {
+        return 0;
+    }
+
+    int Result = -1;
+    for (const auto& Item : m_Windows)
+    {
+        if (!Item.second->IsVisible())
+        {
+            continue;
+        }
+
+        const int Deadline = Item.second->NextTimerDeadline();
+        if (Deadline >= 0)
+        {
+            Result = Result < 0 ? Deadline : std::min<int>(Result, Deadline);
+        }
+    }
+
+    if (m_Player.IsLoaded())
+    {
+        const int Deadline = m_Player.NextDeadline();
+        if (Deadline >= 0)
+        {
+            Result = Result < 0 ? Deadline : std::min<int>(Result, Deadline);
+        }
+    }
+
+    // Language server messages do not wake up the frontend, so they must be polled.
+    if (m_LanguageServer.IsInitialized())
+    {
+        Result = Result < 0 ? IDLE_SLEEP_MS : std::min<int>(Result, IDLE_SLEEP_MS);
+    }
+
+    return Result;
+}
+
 bool Application::IsRunning() const
 {
     return m_IsRunning;
@@ -415,7 +657,7 @@ bool Application::DisplayWindow(const char* ID)
     // resize any controls and fonts based on this scaling.
     if (It->second->RenderScale() != RenderScale)
     {
-        It->second->GetRootContainer()->OnThemeLoaded();
+        It->second->ThemeLoaded();
     }
 
     if (It->second->Modal())
@@ -544,6 +786,11 @@ FileSystem& Application::FS()
     return m_FileSystem;
 }
 
+JobSystem& Application::Jobs()
+{
+    return m_Jobs;
+}
+
 const LanguageServer& Application::LS() const
 {
     return m_LanguageServer;
@@ -619,6 +866,18 @@ Application& Application::SetOnEvent(OnWindowEventSignature&& Fn)
     return *this;
 }
 
+Application& Application::SetOnWaitEvent(OnWaitEventSignature&& Fn)
+{
+    m_OnWaitEvent = std::move(Fn);
+    return *this;
+}
+
+Application& Application::SetOnWake(OnEmptySignature&& Fn)
+{
+    m_OnWake = std::move(Fn);
+    return *this;
+}
+
 Application& Application::SetOnLoadTexture(OnLoadTextureSignature&& Fn)
 {
     m_OnLoadTexture = std::move(Fn);
@@ -667,11 +926,18 @@ Application& Application::SetOnCreateControl(OnCreateControlSignature&& Fn)
     return *this;
 }
 
-void Application::OnPaint(Window* InWindow, const VertexBuffer& Buffers)
+void Application::OnPaint(Window* InWindow, const VertexBuffer& Buffers, const std::vector<Rect>& Damage)
 {
     if (m_OnPaint)
     {
-        m_OnPaint(InWindow, Buffers);
+        m_OnPaint(InWindow, Buffers, Damage);
+    }
+
+    const int64_t Input = InWindow->OldestUnpaintedInput();
+    if (Input > 0)
+    {
+        m_InputLatency.Add(Clock::Timestamp() - Input);
+        InWindow->ClearUnpaintedInput();
     }
 }
 
@@ -682,7 +948,7 @@ std::shared_ptr<Window> Application::CreateWindow(const char* ID)
     Result->SetHighDPI(m_HighDPI);
     Result->SetCustomTitleBar(m_CustomTitleBar);
     Result->CreateContainer();
-    Result->SetOnPaint(std::bind(&Application::OnPaint, this, std::placeholders::_1, std::placeholders::_2));
+    Result->SetOnPaint(std::bind(&Application::OnPaint, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
     Result->SetID(ID);
     return Result;
 }
@@ -742,15 +1008,241 @@ void Application::DestroyWindow(const std::shared_ptr<Window>& Item)
     }
 }
 
-int Application::ProcessEvent(const std::shared_ptr<Window>& Item)
+// Collapses runs of consecutive events that only the latest or accumulated value matters for.
+// Other events end a run so that the order of button, key, and text events is preserved.
+static void CoalesceEvents(std::vector<Event>& Events)
+{
+    if (Events.size() < 2)
+    {
+        return;
+    }
+
+    size_t Count = 1;
+    for (size_t I = 1; I < Events.size(); I++)
+    {
+        Event& Last = Events[Count - 1];
+        const Event& Next = Events[I];
+
+        if (Last.GetType() == Next.GetType())
+        {
+            switch (Next.GetType())
+            {
+            case Event::Type::MouseMoved:
+            case Event::Type::WindowResized:
+            {
+                // Latency is measured from the first of the merged events.
+                const int64_t Timestamp = Last.Timestamp();
+                Last = Next;
+                Last.SetTimestamp(Timestamp);
+            }
+                continue;
+
+            case Event::Type::MouseWheel:
+            {
+                const int64_t Timestamp = Last.Timestamp();
+                const Vector2 Delta = Last.GetData().m_MouseWheel.Delta + Next.GetData().m_MouseWheel.Delta;
+                Last = Event(Event::MouseWheel((int)Delta.X, (int)Delta.Y));
+                Last.SetTimestamp(Timestamp);
+            }
+                continue;
+
+            default: break;
+            }
+        }
+
+        Events[Count++] = Next;
+    }
+
+    Events.erase(Events.begin() + Count, Events.end());
+}
+
+// Windows being painted on the job system workers during a single frame.
+struct PaintBatch
+{
+    std::vector<Window*> Targets {};
+    std::atomic<size_t> Next { 0 };
+    std::atomic<size_t> Pending { 0 };
+    Clock FrameClock {};
+    float Budget { 0.0f };
+    std::mutex Lock {};
+    std::condition_variable Done {};
+
+    void Finish()
+    {
+        if (--Pending == 0)
+        {
+            std::lock_guard<std::mutex> Guard(Lock);
+            Done.notify_all();
+        }
+    }
+};
+
+static void BuildPaints(PaintBatch& Batch)
+{
+    for (size_t I = Batch.Next++; I < Batch.Targets.size(); I = Batch.Next++)
+    {
+        if (Batch.Budget <= 0.0f || Batch.FrameClock.Measure() * 1000.0f < Batch.Budget)
+        {
+            Batch.Targets[I]->BuildPaint();
+        }
+
+        Batch.Finish();
+    }
+}
+
+bool Application::PaintParallel()
+{
+    if (!m_ParallelPaint)
+    {
+        return false;
+    }
+
+#if TOOLS
+    // The profiler records samples from a single thread.
+    if (Tools::Profiler::Get().IsEnabled())
+    {
+        return false;
+    }
+#endif
+
+    m_PaintTargets.clear();
+    for (const auto& Item : m_Windows)
+    {
+        if (Item.second->IsVisible() && Item.second->NeedsRepaint())
+        {
+            m_PaintTargets.push_back(Item.second);
+        }
+    }
+
+    // Without workers the jobs would run inline, so the serial path is used instead.
+    if (m_PaintTargets.size() < 2 || m_Jobs.Workers() == 0)
+    {
+        m_PaintTargets.clear();
+        return false;
+    }
+
+    // The calling thread builds the first window, then claims windows alongside the workers.
+    // The batch is shared with the jobs so that one which starts after the frame has moved
+    // on finds nothing left to claim. Once the frame budget is spent, unclaimed windows keep
+    // their repaint flag and are painted on a later frame, as in the serial path.
+    std::shared_ptr<PaintBatch> Batch = std::make_shared<PaintBatch>();
+    Batch->Targets.reserve(m_PaintTargets.size());
+    for (const std::shared_ptr<Window>& Target : m_PaintTargets)
+    {
+        Batch->Targets.push_back(Target.get());
+    }
+    Batch->Next = 1;
+    Batch->Pending = m_PaintTargets.size();
+    Batch->FrameClock = m_FrameClock;
+    Batch->Budget = (float)m_FrameBudget;
+
+    const size_t Helpers = std::min<size_t>(m_Jobs.Workers(), m_PaintTargets.size() - 1);
+    for (size_t I = 0; I < Helpers; I++)
+    {
+        m_Jobs.Submit([Batch](const JobSystem::CancellationToken&) -> void
+            {
+                BuildPaints(*Batch);
+            },
+            nullptr, JobSystem::Priority::High);
+    }
+
+    m_PaintTargets.front()->BuildPaint();
+    Batch->Finish();
+    BuildPaints(*Batch);
+
+    {
+        std::unique_lock<std::mutex> Lock(Batch->Lock);
+        Batch->Done.wait(Lock, [&]() -> bool
+            {
+                return Batch->Pending == 0;
+            });
+    }
+
+    for (const std::shared_ptr<Window>& Target : m_PaintTargets)
+    {
+        Target->SubmitPaint();
+    }
+
+    m_PaintTargets.clear();
+    return true;
+}
+
+void Application::PrintInputLatency() const
+{
+    if (m_InputLatency.Count() == 0)
+    {
+        printf("Input latency: no samples.\n");
+        return;
+    }
+
+    printf("Input latency over %llu samples: p50 %.2f ms, p95 %.2f ms, p99 %.2f ms, max %.2f ms\n",
+        (unsigned long long)m_InputLatency.Count(),
+        (float)m_InputLatency.Percentile(50.0f) / 1000.0f,
+        (float)m_InputLatency.Percentile(95.0f) / 1000.0f,
+        (float)m_InputLatency.Percentile(99.0f) / 1000.0f,
+        (float)m_InputLatency.Max() / 1000.0f);
+}
+
+int Application::ProcessEvents(const std::shared_ptr<Window>& Item)
 {
     if (!Item)
     {
         return 0;
     }
 
+    // Drain all pending events for the window so that redundant events can be dropped before
+    // any of them are dispatched.
+    m_Events.clear();
+    const int64_t Received = Clock::Timestamp();
+    while (Item->IsVisible())
+    {
+        Event E = m_OnEvent(Item.get());
+        if (E.GetType() == Event::Type::None)
+        {
+            break;
+        }
+
+        if (E.Timestamp() == 0)
+        {
+            E.SetTimestamp(Received);
+        }
+
+        m_Events.push_back(E);
+
+        if (E.GetType() == Event::Type::WindowClosed)
+        {
+            break;
+        }
+    }
+
+    m_CoalescedEvents += (uint32_t)m_Events.size();
+    CoalesceEvents(m_Events);
+    m_CoalescedEvents -= (uint32_t)m_Events.size();
+
     int Processed = 0;
-    Event E = m_OnEvent(Item.get());
+    for (const Event& E : m_Events)
+    {
+        if (!Item->IsVisible())
+        {
+            break;
+        }
+
+        Processed += ProcessEvent(Item, E);
+    }
+
+    return Processed;
+}
+
+int Application::ProcessEvent(const std::shared_ptr<Window>& Item, const Event& E)
+{
+    int Processed = 0;
+
+    m_Recorder.Record(Item->ID(), E);
+
+    if (E.IsInput())
+    {
+        Item->TrackInput(E.Timestamp());
+    }
 
 #if TOOLS
     if (!m_Modals.empty() && !m_IgnoreModals)
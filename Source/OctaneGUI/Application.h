@@ -27,8 +27,14 @@ SOFTWARE.
 #pragma once
 
 #include "CallbackDefs.h"
+#include "Clock.h"
 #include "CommandLine.h"
+#include "DispatchQueue.h"
+#include "Event.h"
+#include "EventRecorder.h"
 #include "FileSystem.h"
+#include "Histogram.h"
+#include "JobSystem.h"
 #include "Keyboard.h"
 #include "LanguageServer.h"
 #include "Mouse.h"
@@ -46,9 +52,9 @@ namespace OctaneGUI
 {
 
 class ControlList;
-class Event;
 class Icons;
 class Json;
+struct Rect;
 class Theme;
 class VertexBuffer;
 class Window;
@@ -87,9 +93,27 @@ enum class WindowAction : uint8_t
 class Application
 {
 public:
+    /// @brief Time spent in each phase of the last frame.
+    struct FrameTimings
+    {
+    public:
+        /// @brief Milliseconds spent processing events.
+        float Events { 0.0f };
+
+        /// @brief Milliseconds spent updating timers and processing layout requests.
+        float Layout { 0.0f };
+
+        /// @brief Milliseconds spent painting windows.
+        float Paint { 0.0f };
+
+        /// @brief Number of windows with layout or paint work carried over to the next frame.
+        uint32_t Deferred { 0 };
+    };
+
     typedef std::function<void(Window*)> OnWindowSignature;
-    typedef std::function<void(Window*, const VertexBuffer&)> OnWindowPaintSignature;
+    typedef std::function<void(Window*, const VertexBuffer&, const std::vector<Rect>&)> OnWindowPaintSignature;
     typedef std::function<Event(Window*)> OnWindowEventSignature;
+    typedef std::function<void(int)> OnWaitEventSignature;
     typedef std::function<void(Window*, WindowAction)> OnWindowActionSignature;
     typedef std::function<uint32_t(const std::vector<uint8_t>&, uint32_t, uint32_t)> OnLoadTextureSignature;
     typedef std::function<void(const std::u32string&)> OnSetClipboardContentsSignature;
@@ -145,8 +169,9 @@ public:
 
     /// @brief Runs the application within a loop until the 'Main' window is requested to close.
     ///
-    /// This function will run every loop iteration as a frame and will sleep if no updates occurred
-    /// within the frame. This is a blocking function and the object will be cleaned up when this returns.
+    /// This function will run every loop iteration as a frame. If no events were processed within
+    /// the frame, the loop waits for the next event or until the earliest running Timer expires.
+    /// This is a blocking function and the object will be cleaned up when this returns.
     /// @return Exit code for the function. 0 is success.
     int Run();
 
@@ -158,6 +183,94 @@ public:
     /// @return Number of events processed this frame,
     int RunFrame();
 
+    /// @brief Number of events that were dropped by merging them with a neighboring event.
+    ///
+    /// Consecutive mouse move and window resize events for a window are collapsed into
+    /// the latest event and consecutive mouse wheel events are summed before any of them
+    /// are dispatched.
+    uint32_t CoalescedEvents() const;
+
+    /// @brief Sets the time each frame should take before remaining work is deferred.
+    ///
+    /// Events are always processed first. Layout requests and window paints that do not fit
+    /// within the remaining time are carried over to the next frame, so input stays
+    /// responsive while heavy layouts are processed. At least one layout request and one
+    /// paint are processed each frame to guarantee progress.
+    ///
+    /// @param Milliseconds The frame budget. 0 disables the budget.
+    /// @return The Application object to allow for chaining methods.
+    Application& SetFrameBudget(int Milliseconds);
+    int FrameBudget() const;
+
+    /// @brief Sets whether the vertex buffers of multiple windows are built on the job system
+    /// workers.
+    ///
+    /// The buffers are submitted to the frontend in order on the calling thread once all of
+    /// them are built. Controls must not modify shared state, such as the Theme, while
+    /// painting. Windows not yet started when the frame budget runs out are deferred to a
+    /// later frame. Windows are painted serially if the job system has no workers.
+    ///
+    /// @param ParallelPaint Boolean to enable parallel painting.
+    /// @return The Application object to allow for chaining methods.
+    Application& SetParallelPaint(bool ParallelPaint);
+    bool ParallelPaint() const;
+
+    /// @brief Queues a function to run on the main thread at the start of the next frame.
+    ///
+    /// This is the only Application function that is safe to call from other threads. It
+    /// does not block and wakes up the Run loop if it is waiting for events.
+    ///
+    /// @param Fn The function to run.
+    /// @return The Application object to allow for chaining methods.
+    Application& Post(DispatchQueue::OnDispatchSignature&& Fn);
+
+    /// @brief Records every event processed by any window to the given file.
+    ///
+    /// Recording can also be started with the '--record <file>' command-line argument.
+    ///
+    /// @param Path Location of the file to write.
+    /// @return True if the file was opened.
+    bool StartRecording(const char* Path);
+    void StopRecording();
+    bool IsRecording() const;
+
+    /// @brief Replaces the frontend's events with the events from a recorded file.
+    ///
+    /// Replays run without any system windows. The frontend is not asked to create windows,
+    /// paint, load textures, or wait for events. The application quits once every event has
+    /// been processed. This must be called before Initialize, which also starts a replay when
+    /// given the '--replay <file>' command-line argument.
+    ///
+    /// @param Path Location of a file written by StartRecording.
+    /// @return True if the file was loaded.
+    bool Replay(const char* Path);
+    bool IsReplaying() const;
+
+    /// @brief Distribution of the time in microseconds from when an input event was received
+    /// to when the first paint submitted after it was handed to the frontend.
+    ///
+    /// Input that does not lead to a repaint is not counted. The percentiles are printed on
+    /// exit when given the '--latency' command-line argument.
+    ///
+    /// @return const Histogram reference.
+    const Histogram& InputLatency() const;
+
+    /// @brief Mutable version of the input latency Histogram.
+    /// @return Histogram reference.
+    Histogram& InputLatency();
+
+    /// @brief Timings of each phase for the last frame run by RunFrame.
+    const FrameTimings& GetFrameTimings() const;
+
+    /// @brief Number of milliseconds the application can wait for an event before it needs to
+    /// run another frame.
+    ///
+    /// This is determined by the earliest running Timer of all visible windows. Returns 0 if
+    /// the last frame deferred any work or there are posted functions waiting to run.
+    ///
+    /// @return The timeout in milliseconds, or -1 if the application can wait indefinitely.
+    int WaitTimeout() const;
+
     /// @brief Returns whether the app is still running.
     ///
     /// This will return false if the Application object was not initialized, or if there was
@@ -294,6 +407,14 @@ public:
     /// @return FileSystem reference.
     FileSystem& FS();
 
+    /// @brief Pool of worker threads for work that should not block the main thread.
+    ///
+    /// The number of workers is set with the '--jobs' command-line argument and defaults to
+    /// the number of hardware threads.
+    ///
+    /// @return JobSystem reference.
+    JobSystem& Jobs();
+
     /// @brief Const version of the LanguageServer object.
     /// @return const LanguageServer reference.
     const LanguageServer& LS() const;
@@ -346,7 +467,10 @@ public:
     /// @brief Window paint notification that must be handled by the frontend.
     ///
     /// This callback is invoked whenever a Window object needs to be repainted
-    /// due to any updates that may have occurred within the window.
+    /// due to any updates that may have occurred within the window. The list of
+    /// damaged regions describes which areas of the window changed since the last
+    /// paint. Frontends that preserve the previous frame may limit rendering to
+    /// these regions.
     ///
     /// @param Fn The OnWindowPaintSignature callback.
     /// @return The Application object to allow for chaining methods.
@@ -371,6 +495,25 @@ public:
     /// @return The Application object to allow for chaining methods.
     Application& SetOnEvent(OnWindowEventSignature&& Fn);
 
+    /// @brief Request for the frontend to block until a system event is available.
+    ///
+    /// This callback is invoked during the Run loop when no events were processed
+    /// within a frame. The frontend should return once an event is available for any
+    /// window or the given timeout in milliseconds has elapsed. A timeout of -1 means
+    /// there is no deadline. If no callback is set, the Run loop sleeps instead.
+    ///
+    /// @param Fn The OnWaitEventSignature callback.
+    /// @return The Application object to allow for chaining methods.
+    Application& SetOnWaitEvent(OnWaitEventSignature&& Fn);
+
+    /// @brief Request for the frontend to return from a blocking OnWaitEvent call.
+    ///
+    /// This callback is invoked by Post and may be called from any thread.
+    ///
+    /// @param Fn An OnEmptySignature callback.
+    /// @return The Application object to allow for chaining methods.
+    Application& SetOnWake(OnEmptySignature&& Fn);
+
     /// @brief Request for the frontend to load a texture.
     ///
     /// This callback is invoked whenever the library makes a request to load
@@ -427,10 +570,13 @@ public:
     Application& SetOnCreateControl(OnCreateControlSignature&& Fn);
 
 private:
-    void OnPaint(Window* InWindow, const VertexBuffer& Buffer);
+    void OnPaint(Window* InWindow, const VertexBuffer& Buffer, const std::vector<Rect>& Damage);
     std::shared_ptr<Window> CreateWindow(const char* ID);
     void DestroyWindow(const std::shared_ptr<Window>& Item);
-    int ProcessEvent(const std::shared_ptr<Window>& Item);
+    bool PaintParallel();
+    void PrintInputLatency() const;
+    int ProcessEvents(const std::shared_ptr<Window>& Item);
+    int ProcessEvent(const std::shared_ptr<Window>& Item, const Event& E);
     bool Initialize();
     void OnWindowAction(Window* InWindow, WindowAction Action);
     void LoadIcons(const Json& Root);
@@ -441,6 +587,19 @@ private:
     std::unordered_map<std::string, std::shared_ptr<Window>> m_Windows;
     std::vector<std::weak_ptr<Window>> m_Modals {};
     std::weak_ptr<Window> m_EventFocus {};
+    std::vector<Event> m_Events {};
+    uint32_t m_CoalescedEvents { 0 };
+    int m_FrameBudget { 0 };
+    bool m_ParallelPaint { false };
+    DispatchQueue m_DispatchQueue {};
+    JobSystem m_Jobs { *this };
+    EventRecorder m_Recorder {};
+    EventPlayer m_Player {};
+    uint32_t m_ReplayFrames { 0 };
+    Histogram m_InputLatency {};
+    std::vector<std::shared_ptr<Window>> m_PaintTargets {};
+    Clock m_FrameClock {};
+    FrameTimings m_FrameTimings {};
     std::shared_ptr<Theme> m_Theme { nullptr };
     std::shared_ptr<Icons> m_Icons { nullptr };
     bool m_IsRunning { false };
@@ -461,6 +620,8 @@ private:
     OnWindowPaintSignature m_OnPaint { nullptr };
     OnEmptySignature m_OnNewFrame { nullptr };
     OnWindowEventSignature m_OnEvent { nullptr };
+    OnWaitEventSignature m_OnWaitEvent { nullptr };
+    OnEmptySignature m_OnWake { nullptr };
     OnLoadTextureSignature m_OnLoadTexture { nullptr };
     OnEmptySignature m_OnExit { nullptr };
     OnSetClipboardContentsSignature m_OnSetClipboardContents { nullptr };
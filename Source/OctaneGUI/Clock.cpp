@@ -29,6 +29,11 @@ SOFTWARE.
 namespace OctaneGUI
 {
 
+int64_t Clock::Timestamp()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 Clock::Clock()
 {
 }
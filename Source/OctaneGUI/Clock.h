@@ -34,6 +34,9 @@ namespace OctaneGUI
 class Clock
 {
 public:
+    /// @brief Microseconds on a monotonic clock. Used to compare event time stamps.
+    static int64_t Timestamp();
+
     Clock();
 
     float Measure() const;
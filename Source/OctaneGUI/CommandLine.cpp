@@ -47,6 +47,19 @@ CommandLine& CommandLine::Set(int Argc, char** Argv)
     return *this;
 }
 
+bool CommandLine::Has(const char* Argument) const
+{
+    for (const std::string& Arg : m_Arguments)
+    {
+        if (Arg == Argument)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 std::string CommandLine::Get(const char* Argument) const
 {
     bool Next { false };
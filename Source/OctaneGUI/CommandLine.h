@@ -41,6 +41,7 @@ public:
 
     CommandLine& Set(int Argc, char** Argv);
 
+    bool Has(const char* Argument) const;
     std::string Get(const char* Argument) const;
     int GetInt(const char* Argument, int Default = 0) const;
 
@@ -26,7 +26,9 @@ SOFTWARE.
 
 #include "BoxContainer.h"
 #include "../Json.h"
+#include "../ScratchArena.h"
 #include "../String.h"
+#include "../Window.h"
 
 namespace OctaneGUI
 {
@@ -80,6 +82,7 @@ Grow BoxContainer::GrowDirection() const
 BoxContainer& BoxContainer::SetSpacing(const Vector2& Spacing)
 {
     m_Spacing = Spacing;
+    Invalidate(InvalidateType::Layout);
     return *this;
 }
 
@@ -91,6 +94,7 @@ Vector2 BoxContainer::Spacing() const
 BoxContainer& BoxContainer::SetIgnoreDesiredSize(bool IgnoreDesiredSize)
 {
     m_IgnoreDesiredSize = IgnoreDesiredSize;
+    Invalidate(InvalidateType::Layout);
     return *this;
 }
 
@@ -111,10 +115,10 @@ Vector2 BoxContainer::DesiredSize() const
     for (const std::shared_ptr<Control>& Item : Controls())
     {
         Vector2 Size = Item->GetSize();
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Item->AsContainer();
         if (ItemContainer)
         {
-            Size = ItemContainer->DesiredSize();
+            Size = ItemContainer->CachedDesiredSize();
         }
 
         if (m_Orient == Orientation::Horizontal)
@@ -160,18 +164,20 @@ void BoxContainer::PlaceControls(const std::vector<std::shared_ptr<Control>>& Co
     int ExpandH = 0;
     const Vector2 TotalSpacing = m_Spacing * (float)(Controls.size() > 0 ? Controls.size() - 1 : 0);
     Vector2 AvailableSize = GetSize() - TotalSpacing;
-    std::unordered_map<Control*, Vector2> DesiredSizes;
-    for (const std::shared_ptr<Control>& Item : Controls)
+    const ScratchArena::Scope Scratch { GetWindow()->Scratch() };
+    Vector2* DesiredSizes = GetWindow()->Scratch().Allocate<Vector2>(Controls.size());
+    for (size_t I = 0; I < Controls.size(); I++)
     {
+        const std::shared_ptr<Control>& Item = Controls[I];
         Vector2 Size = Item->GetSize();
 
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Item->AsContainer();
         if (ItemContainer)
         {
-            Size = ItemContainer->DesiredSize();
+            Size = ItemContainer->CachedDesiredSize();
         }
 
-        DesiredSizes[Item.get()] = Size;
+        DesiredSizes[I] = Size;
 
         switch (Item->GetExpand())
         {
@@ -228,9 +234,10 @@ void BoxContainer::PlaceControls(const std::vector<std::shared_ptr<Control>>& Co
     //	  TODO: Mayby check if AvailableSize is zero and size any left over controls to zero?
     Vector2 TotalSize = TotalSpacing;
     AvailableSize = GetSize();
-    for (const std::shared_ptr<Control>& Item : Controls)
+    for (size_t I = 0; I < Controls.size(); I++)
     {
-        Vector2 Size = DesiredSizes[Item.get()];
+        const std::shared_ptr<Control>& Item = Controls[I];
+        Vector2 Size = DesiredSizes[I];
 
         switch (Item->GetExpand())
         {
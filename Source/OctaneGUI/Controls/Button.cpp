@@ -58,6 +58,7 @@ Button& Button::SetOnReleased(OnButtonSignature&& Fn)
 Button& Button::SetDisabled(bool Disabled)
 {
     m_Disabled = Disabled;
+    Invalidate();
     return *this;
 }
 
@@ -84,6 +85,7 @@ Button& Button::SetRadius(float Radius)
 Button& Button::SetRadius(const Rect& Radius)
 {
     m_Radius = Radius;
+    Invalidate();
     return *this;
 }
 
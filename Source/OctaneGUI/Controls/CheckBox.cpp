@@ -75,6 +75,7 @@ const char32_t* CheckBox::GetText() const
 CheckBox& CheckBox::SetState(State InState)
 {
     m_State = InState;
+    Invalidate();
     return *this;
 }
 
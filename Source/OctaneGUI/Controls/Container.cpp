@@ -60,18 +60,103 @@ SOFTWARE.
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+
+#if TOOLS
+    #include <map>
+    #include <mutex>
+    #include <string>
+#endif
+
+// Containers with fewer children than this are searched linearly.
+#define HIT_GRID_THRESHOLD 32
+
+// Extents are computed in local space while hits are tested in absolute space, so the grid is
+// padded to absorb rounding differences between the two.
+#define HIT_GRID_MARGIN 1.0f
 
 namespace OctaneGUI
 {
 
+#if TOOLS
+// Profiler labels are built once per control type so that layout and paint do not allocate.
+// Paint may run on worker threads, so the labels are guarded by a lock.
+static const char* SampleLabel(const char* Type, const char* Suffix)
+{
+    static std::map<std::pair<const char*, const char*>, std::string> Labels;
+    static std::mutex Lock;
+
+    std::lock_guard<std::mutex> Guard(Lock);
+    std::string& Result = Labels[{ Type, Suffix }];
+    if (Result.empty())
+    {
+        Result = std::string(Type) + Suffix;
+    }
+
+    return Result.c_str();
+}
+#endif
+
+static bool HitTest(const std::shared_ptr<Control>& Item, const Vector2& Point, const Vector2& Origin, std::weak_ptr<Control>& Result)
+{
+    Container* ItemContainer = Item->AsContainer();
+    if (ItemContainer)
+    {
+        Result = ItemContainer->GetControl(Point);
+    }
+    else
+    {
+        // Same as Item->Contains but without walking up the parents again.
+        Rect Bounds = Item->GetBounds();
+        Bounds.SetPosition(Origin + Item->GetPosition());
+        if (Bounds.Contains(Point))
+        {
+            Result = Item;
+        }
+    }
+
+    return !Result.expired();
+}
+
+static void Encompass(Rect& Target, const Rect& Other)
+{
+    Target.Min.X = std::min<float>(Target.Min.X, Other.Min.X);
+    Target.Min.Y = std::min<float>(Target.Min.Y, Other.Min.Y);
+    Target.Max.X = std::max<float>(Target.Max.X, Other.Max.X);
+    Target.Max.Y = std::max<float>(Target.Max.Y, Other.Max.Y);
+}
+
+static uint32_t Cell(float Value, float Min, float Size, uint32_t Count)
+{
+    const float Result = std::floor((Value - Min) / Size);
+    if (Result <= 0.0f)
+    {
+        return 0;
+    }
+
+    return std::min<uint32_t>((uint32_t)Result, Count - 1);
+}
+
 Container::Container(Window* InWindow)
     : Control(InWindow)
 {
+    m_IsContainer = true;
     SetForwardKeyEvents(true);
+    SetCachePaint(false);
 }
 
 Container::~Container()
 {
+    // Children that outlive this container must not walk back up to it.
+    for (const std::shared_ptr<Control>& Item : m_Controls)
+    {
+        if (Item->GetParent() == this)
+        {
+            Item->SetParent(nullptr);
+            Item->SetOnInvalidate(nullptr);
+        }
+    }
+
     m_Controls.clear();
 }
 
@@ -217,6 +302,7 @@ Container* Container::InsertControl(const std::shared_ptr<Control>& Item, int Po
         m_Controls.push_back(Item);
     }
 
+    InvalidateHitIndex();
     Invalidate(Item, InvalidateType::Paint);
     Invalidate(InvalidateType::Layout);
     OnInsertControl(Item);
@@ -230,6 +316,7 @@ Container* Container::RemoveControl(const std::shared_ptr<Control>& Item)
     if (Iter != m_Controls.end())
     {
         m_Controls.erase(Iter);
+        InvalidateHitIndex();
         Invalidate(InvalidateType::Both);
         OnRemoveControl(Item);
         Item->OnRemoved(*this);
@@ -252,7 +339,7 @@ bool Container::HasControlRecurse(const std::shared_ptr<Control>& Item) const
 
     for (const std::shared_ptr<Control>& Child : Controls())
     {
-        const std::shared_ptr<Container>& ChildContainer = std::dynamic_pointer_cast<Container>(Child);
+        Container* ChildContainer = Child->AsContainer();
         if (ChildContainer && ChildContainer->HasControlRecurse(Item))
         {
             return true;
@@ -265,6 +352,7 @@ bool Container::HasControlRecurse(const std::shared_ptr<Control>& Item) const
 void Container::ClearControls()
 {
     m_Controls.clear();
+    InvalidateHitIndex();
     Invalidate(InvalidateType::Both);
 }
 
@@ -282,6 +370,7 @@ const std::shared_ptr<Control>& Container::Get(size_t Index) const
 Container& Container::SetClip(bool Clip)
 {
     m_Clip = Clip;
+    InvalidateHitIndex();
     return *this;
 }
 
@@ -292,7 +381,7 @@ bool Container::ShouldClip() const
 
 Container* Container::Layout()
 {
-    PROFILER_SAMPLE_GROUP((std::string(GetType()) + "::Layout").c_str());
+    PROFILER_SAMPLE_GROUP(SampleLabel(GetType(), "::Layout"));
 
     m_InLayout = true;
 
@@ -301,15 +390,18 @@ Container* Container::Layout()
         PlaceControls(m_Controls);
     }
 
+    // Remember the sizes the children were placed with so that later changes can be detected.
     for (const std::shared_ptr<Control>& Item : m_Controls)
     {
-        const std::shared_ptr<Container> Child = std::dynamic_pointer_cast<Container>(Item);
+        Container* Child = Item->AsContainer();
         if (Child)
         {
-            Child->Layout();
+            Child->m_PlacedDesiredSize = Child->CachedDesiredSize();
         }
     }
 
+    LayoutChildren();
+
     {
         PROFILER_SAMPLE("Update");
         for (const std::shared_ptr<Control>& Item : m_Controls)
@@ -321,34 +413,141 @@ Container* Container::Layout()
     OnLayoutComplete();
 
     m_InLayout = false;
+    m_LayoutDirty = false;
 
     return this;
 }
 
+void Container::LayoutChildren()
+{
+    // Children that kept their size and were not invalidated are already laid out, but may
+    // have invalidated containers further down.
+    for (const std::shared_ptr<Control>& Item : m_Controls)
+    {
+        Container* Child = Item->AsContainer();
+        if (Child == nullptr)
+        {
+            continue;
+        }
+
+        if (Child->m_LayoutDirty)
+        {
+            Child->Layout();
+        }
+        else if (Child->m_ChildrenDirty)
+        {
+            Child->LayoutDirtyChildren();
+        }
+    }
+
+    m_ChildrenDirty = false;
+}
+
+void Container::LayoutDirtyChildren()
+{
+    // The children only need to be placed again if one of them wants a different size.
+    for (const std::shared_ptr<Control>& Item : m_Controls)
+    {
+        const Container* Child = Item->AsContainer();
+        if (Child && (Child->m_LayoutDirty || Child->m_ChildrenDirty) && Child->DesiredSizeChanged())
+        {
+            Layout();
+            return;
+        }
+    }
+
+    m_InLayout = true;
+    LayoutChildren();
+    m_InLayout = false;
+}
+
+bool Container::NeedsLayout() const
+{
+    return m_LayoutDirty;
+}
+
+bool Container::DesiredSizeChanged() const
+{
+    return CachedDesiredSize() != m_PlacedDesiredSize;
+}
+
 void Container::InvalidateLayout()
 {
     Invalidate(InvalidateType::Layout);
 }
 
+void Container::InvalidateAllLayouts()
+{
+    InvalidateMeasureCache();
+    m_LayoutDirty = true;
+
+    for (const std::shared_ptr<Control>& Item : m_Controls)
+    {
+        Container* Child = Item->AsContainer();
+        if (Child != nullptr)
+        {
+            Child->InvalidateAllLayouts();
+        }
+    }
+}
+
+Container& Container::SetLayoutRequest(uint32_t Generation)
+{
+    m_LayoutRequest = Generation;
+    return *this;
+}
+
+uint32_t Container::LayoutRequest() const
+{
+    return m_LayoutRequest;
+}
+
 std::weak_ptr<Control> Container::GetControl(const Vector2& Point) const
 {
     std::weak_ptr<Control> Result;
 
-    for (int I = (int)m_Controls.size() - 1; I >= 0; I--)
-    {
-        const std::shared_ptr<Control>& Item = m_Controls[I];
+    UpdateHitIndex();
 
-        const std::shared_ptr<Container> ItemContainer = std::dynamic_pointer_cast<Container>(Item);
-        if (ItemContainer)
+    const Vector2 Origin = GetAbsolutePosition();
+    if (m_Clip)
+    {
+        Rect Bounds = GetBounds();
+        Bounds.SetPosition(Origin);
+        if (!Bounds.Contains(Point))
         {
-            Result = ItemContainer->GetControl(Point);
+            return Result;
         }
-        else if (Item->Contains(Point))
+    }
+
+    if (m_HitIndex.Columns == 0)
+    {
+        for (int I = (int)m_Controls.size() - 1; I >= 0; I--)
         {
-            Result = Item;
+            if (HitTest(m_Controls[I], Point, Origin, Result))
+            {
+                break;
+            }
         }
 
-        if (!Result.expired())
+        return Result;
+    }
+
+    const Vector2 Local = Point - Origin;
+    const Rect& Extent = m_HitIndex.Extent;
+    if (Local.X < Extent.Min.X - HIT_GRID_MARGIN || Local.X > Extent.Max.X + HIT_GRID_MARGIN
+        || Local.Y < Extent.Min.Y - HIT_GRID_MARGIN || Local.Y > Extent.Max.Y + HIT_GRID_MARGIN)
+    {
+        return Result;
+    }
+
+    const uint32_t Column = Cell(Local.X, Extent.Min.X, m_HitIndex.CellSize.X, m_HitIndex.Columns);
+    const uint32_t Row = Cell(Local.Y, Extent.Min.Y, m_HitIndex.CellSize.Y, m_HitIndex.Rows);
+    const uint32_t Index = Row * m_HitIndex.Columns + Column;
+
+    // Items are stored in paint order, so search from the back to find the top-most control.
+    for (uint32_t I = m_HitIndex.CellStart[Index + 1]; I > m_HitIndex.CellStart[Index]; I--)
+    {
+        if (HitTest(m_Controls[m_HitIndex.CellItems[I - 1]], Point, Origin, Result))
         {
             break;
         }
@@ -357,13 +556,61 @@ std::weak_ptr<Control> Container::GetControl(const Vector2& Point) const
     return Result;
 }
 
+void Container::UpdateHitIndex() const
+{
+    if (m_HitIndex.Valid)
+    {
+        return;
+    }
+
+    m_HitIndex.Valid = true;
+    m_HitIndex.Columns = 0;
+    m_HitIndex.Rows = 0;
+    m_HitIndex.Extent = { {}, GetSize() };
+
+    // Clipped children can only be found within this container's bounds.
+    for (const std::shared_ptr<Control>& Item : m_Controls)
+    {
+        const Rect Extent = ChildExtent(*Item);
+        if (!m_Clip)
+        {
+            Encompass(m_HitIndex.Extent, Extent);
+        }
+    }
+
+    if (m_Controls.size() >= HIT_GRID_THRESHOLD)
+    {
+        BuildHitGrid();
+    }
+}
+
+void Container::InvalidateHitIndex() const
+{
+    for (Control const* Item = this; Item != nullptr; Item = Item->GetParent())
+    {
+        const Container* ItemContainer = Item->AsContainer();
+        if (ItemContainer == nullptr)
+        {
+            continue;
+        }
+
+        // An invalid index means all of its parents have already been invalidated.
+        if (ItemContainer != this && !ItemContainer->m_HitIndex.Valid)
+        {
+            break;
+        }
+
+        ItemContainer->m_HitIndex.Valid = false;
+    }
+}
+
 void Container::GetControls(std::vector<std::shared_ptr<Control>>& Controls) const
 {
     for (const std::shared_ptr<Control>& Item : m_Controls)
     {
         Controls.push_back(Item);
 
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Item->AsContainer();
         if (ItemContainer)
         {
             ItemContainer->GetControls(Controls);
@@ -373,16 +620,21 @@ void Container::GetControls(std::vector<std::shared_ptr<Control>>& Controls) con
 
 Vector2 Container::ChildrenSize() const
 {
+    if (m_MeasureCache.ChildrenSizeValid)
+    {
+        return m_MeasureCache.ChildrenSize;
+    }
+
     Vector2 Result;
 
     for (const std::shared_ptr<Control>& Item : m_Controls)
     {
         Vector2 Size = Item->GetSize();
 
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Item->AsContainer();
         if (ItemContainer)
         {
-            Size = ItemContainer->DesiredSize();
+            Size = ItemContainer->CachedDesiredSize();
             const Vector2 ChildrenSize = ItemContainer->ChildrenSize();
             Size.X = std::max<float>(Size.X, ChildrenSize.X);
             Size.Y = std::max<float>(Size.Y, ChildrenSize.Y);
@@ -392,6 +644,8 @@ Vector2 Container::ChildrenSize() const
         Result.Y = std::max<float>(Result.Y, Size.Y);
     }
 
+    m_MeasureCache.ChildrenSize = Result;
+    m_MeasureCache.ChildrenSizeValid = true;
     return Result;
 }
 
@@ -401,7 +655,7 @@ void Container::GetControlList(ControlList& List) const
 
     for (const std::shared_ptr<Control>& Item : Controls())
     {
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Item->AsContainer();
         if (ItemContainer)
         {
             ItemContainer->GetControlList(List);
@@ -419,10 +673,24 @@ Vector2 Container::DesiredSize() const
     return GetSize();
 }
 
+Vector2 Container::CachedDesiredSize() const
+{
+    if (!m_MeasureCache.DesiredSizeValid)
+    {
+        m_MeasureCache.DesiredSize = DesiredSize();
+        m_MeasureCache.DesiredSizeValid = true;
+    }
+
+    return m_MeasureCache.DesiredSize;
+}
+
 void Container::SetWindow(Window* InWindow)
 {
     Control::SetWindow(InWindow);
 
+    // Generations are tracked per window.
+    m_LayoutRequest = 0;
+
     for (const std::shared_ptr<Control>& Item : m_Controls)
     {
         Item->SetWindow(InWindow);
@@ -431,7 +699,7 @@ void Container::SetWindow(Window* InWindow)
 
 void Container::OnPaint(Paint& Brush) const
 {
-    PROFILER_SAMPLE_GROUP((std::string(GetType()) + "::OnPaint").c_str());
+    PROFILER_SAMPLE_GROUP(SampleLabel(GetType(), "::OnPaint"));
 
     if (ShouldClip())
     {
@@ -440,9 +708,10 @@ void Container::OnPaint(Paint& Brush) const
 
     for (const std::shared_ptr<Control>& Item : m_Controls)
     {
-        if (!Brush.IsClipped(Item->GetAbsoluteBounds()))
+        const Rect Bounds = Item->GetAbsoluteBounds();
+        if (!Brush.IsClipped(Bounds) && Brush.IsDamaged(Bounds))
         {
-            Item->OnPaint(Brush);
+            Item->DoPaint(Brush);
         }
     }
 
@@ -508,7 +777,7 @@ bool Container::IsInLayout() const
         return true;
     }
 
-    Container const* Parent = dynamic_cast<Container const*>(GetParent());
+    Container const* Parent = GetParent() != nullptr ? GetParent()->AsContainer() : nullptr;
     if (Parent != nullptr)
     {
         return Parent->IsInLayout();
@@ -532,10 +801,10 @@ void Container::PlaceControls(const std::vector<std::shared_ptr<Control>>& Contr
     for (const std::shared_ptr<Control>& Item : Controls)
     {
         Vector2 ItemSize = Item->GetSize();
-        const std::shared_ptr<Container> ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Item->AsContainer();
         if (ItemContainer)
         {
-            ItemSize = ItemContainer->DesiredSize();
+            ItemSize = ItemContainer->CachedDesiredSize();
         }
         Expand Direction = Item->GetExpand();
 
@@ -564,4 +833,106 @@ void Container::OnLayoutComplete()
 {
 }
 
+Rect Container::ChildExtent(const Control& Item) const
+{
+    Rect Result = { {}, Item.GetSize() };
+
+    const Container* ItemContainer = Item.AsContainer();
+    if (ItemContainer != nullptr)
+    {
+        ItemContainer->UpdateHitIndex();
+        Result = ItemContainer->m_HitIndex.Extent;
+    }
+
+    Result.Min += Item.GetPosition();
+    Result.Max += Item.GetPosition();
+    return Result;
+}
+
+void Container::BuildHitGrid() const
+{
+    HitIndex& Index = m_HitIndex;
+    const Vector2 Size = Index.Extent.GetSize();
+    if (Size.X <= 0.0f || Size.Y <= 0.0f)
+    {
+        return;
+    }
+
+    // Aim for about one child per cell with cells shaped like the extent. Lists end up with a
+    // single column and rows close to the height of an item.
+    const float Count = (float)m_Controls.size();
+    Index.Columns = (uint32_t)std::max<float>(1.0f, std::min<float>(Count, std::round(std::sqrt(Count * Size.X / Size.Y))));
+    Index.Rows = (uint32_t)std::max<float>(1.0f, std::min<float>(Count, std::ceil(Count / (float)Index.Columns)));
+    Index.CellSize = { Size.X / (float)Index.Columns, Size.Y / (float)Index.Rows };
+
+    const uint32_t Cells = Index.Columns * Index.Rows;
+    Index.CellStart.assign(Cells + 1, 0);
+    Index.Cursor.resize(Cells);
+
+    // Visits the range of cells that a child overlaps. Children that can never be hit are skipped.
+    const auto ForEachCell = [&](const Control& Item, const auto& Fn) -> void
+    {
+        if (!Item.IsContainer() && (Item.GetSize().X == 0.0f || Item.GetSize().Y == 0.0f))
+        {
+            return;
+        }
+
+        const Rect Extent = ChildExtent(Item);
+        const uint32_t MinX = Cell(Extent.Min.X - HIT_GRID_MARGIN, Index.Extent.Min.X, Index.CellSize.X, Index.Columns);
+        const uint32_t MaxX = Cell(Extent.Max.X + HIT_GRID_MARGIN, Index.Extent.Min.X, Index.CellSize.X, Index.Columns);
+        const uint32_t MinY = Cell(Extent.Min.Y - HIT_GRID_MARGIN, Index.Extent.Min.Y, Index.CellSize.Y, Index.Rows);
+        const uint32_t MaxY = Cell(Extent.Max.Y + HIT_GRID_MARGIN, Index.Extent.Min.Y, Index.CellSize.Y, Index.Rows);
+        for (uint32_t Y = MinY; Y <= MaxY; Y++)
+        {
+            for (uint32_t X = MinX; X <= MaxX; X++)
+            {
+                Fn(Y * Index.Columns + X);
+            }
+        }
+    };
+
+    for (const std::shared_ptr<Control>& Item : m_Controls)
+    {
+        ForEachCell(*Item, [&](uint32_t Slot) -> void
+            {
+                Index.CellStart[Slot + 1]++;
+            });
+    }
+
+    for (uint32_t I = 0; I < Cells; I++)
+    {
+        Index.CellStart[I + 1] += Index.CellStart[I];
+        Index.Cursor[I] = Index.CellStart[I];
+    }
+
+    Index.CellItems.resize(Index.CellStart[Cells]);
+    for (uint32_t I = 0; I < (uint32_t)m_Controls.size(); I++)
+    {
+        ForEachCell(*m_Controls[I], [&](uint32_t Slot) -> void
+            {
+                Index.CellItems[Index.Cursor[Slot]++] = I;
+            });
+    }
+}
+
+void Container::MarkLayoutDirty()
+{
+    m_LayoutDirty = true;
+
+    for (Control* Item = GetParent(); Item != nullptr; Item = Item->GetParent())
+    {
+        Container* ItemContainer = Item->AsContainer();
+        if (ItemContainer != nullptr)
+        {
+            ItemContainer->m_ChildrenDirty = true;
+        }
+    }
+}
+
+void Container::InvalidateMeasureCache() const
+{
+    m_MeasureCache.DesiredSizeValid = false;
+    m_MeasureCache.ChildrenSizeValid = false;
+}
+
 }
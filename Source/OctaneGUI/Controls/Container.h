@@ -72,9 +72,31 @@ public:
     Container& SetClip(bool Clip);
     bool ShouldClip() const;
 
+    /// @brief Places all children, then lays out the child containers that were resized or
+    /// had their layout invalidated. Child containers that are unchanged are skipped.
     Container* Layout();
     void InvalidateLayout();
 
+    /// @brief Discards the cached measurements of this container and every container within
+    /// it, and marks all of them to be laid out again. Used when a change such as a theme
+    /// reload may affect the size of any control.
+    void InvalidateAllLayouts();
+
+    /// @brief Whether this container has been invalidated or resized since its last layout.
+    bool NeedsLayout() const;
+
+    /// @brief Whether the desired size of this container is different from the one its parent
+    /// last placed it with. If so, the parent needs to be laid out instead of this container.
+    bool DesiredSizeChanged() const;
+
+    /// @brief Marks this container as requesting a layout during the given window layout generation.
+    ///
+    /// The owning Window uses this to find out in O(depth) whether a container or any of its
+    /// parents already has a pending layout request. Marks from previous generations are
+    /// stale and do not need to be cleared.
+    Container& SetLayoutRequest(uint32_t Generation);
+    uint32_t LayoutRequest() const;
+
     template <class T>
     std::shared_ptr<T> Ref(T* Ptr) const
     {
@@ -89,13 +111,34 @@ public:
         return nullptr;
     }
 
+    /// @brief Finds the top-most control at the given point.
+    ///
+    /// Containers with many children keep a grid of their children's bounds so that only the
+    /// children near the point are tested. Children of a clipped container are only found
+    /// within the container's bounds.
+    ///
+    /// @param Point Absolute position to test.
+    /// @return The control at the point or an expired pointer if there is none.
     virtual std::weak_ptr<Control> GetControl(const Vector2& Point) const;
+
+    /// @brief Rebuilds the spatial index used by GetControl if any child has moved, resized,
+    /// been added, or been removed. Only containers that changed are rebuilt.
+    void UpdateHitIndex() const;
+
+    /// @brief Marks the spatial index of this container and its parents as out of date.
+    void InvalidateHitIndex() const;
     // TODO: Rename to GetAllControls.
     void GetControls(std::vector<std::shared_ptr<Control>>& Controls) const;
     const std::vector<std::shared_ptr<Control>>& Controls() const;
+    /// @brief Largest size of all children including their contents. The result is cached
+    /// until a layout is invalidated on this container or any of its children.
     Vector2 ChildrenSize() const;
     virtual void GetControlList(ControlList& List) const;
     virtual Vector2 DesiredSize() const;
+
+    /// @brief Returns the result of DesiredSize, which is cached until a layout is invalidated
+    /// on this container or any of its children. Layouts should measure children with this.
+    Vector2 CachedDesiredSize() const;
     virtual void SetWindow(Window* InWindow) override;
 
     virtual void OnPaint(Paint& Brush) const override;
@@ -111,11 +154,51 @@ protected:
     virtual void OnInsertControl(const std::shared_ptr<Control>& Item);
     virtual void OnRemoveControl(const std::shared_ptr<Control>& Item);
     virtual void OnLayoutComplete();
+    virtual void InvalidateMeasureCache() const override;
+    virtual void MarkLayoutDirty() override;
 
 private:
+    struct MeasureCache
+    {
+    public:
+        Vector2 DesiredSize {};
+        Vector2 ChildrenSize {};
+        bool DesiredSizeValid { false };
+        bool ChildrenSizeValid { false };
+    };
+
+    // Grid of children's bounds in this container's local space. Each cell lists the indices
+    // of the children that overlap it in paint order.
+    struct HitIndex
+    {
+    public:
+        Rect Extent {};
+        Vector2 CellSize {};
+        uint32_t Columns { 0 };
+        uint32_t Rows { 0 };
+        std::vector<uint32_t> CellStart {};
+        std::vector<uint32_t> CellItems {};
+        std::vector<uint32_t> Cursor {};
+        bool Valid { false };
+    };
+
+    void LayoutChildren();
+    void LayoutDirtyChildren();
+
+    Rect ChildExtent(const Control& Item) const;
+    void BuildHitGrid() const;
+
     std::vector<std::shared_ptr<Control>> m_Controls;
     bool m_InLayout { false };
+    uint32_t m_LayoutRequest { 0 };
+    bool m_LayoutDirty { true };
+    bool m_ChildrenDirty { false };
+    Vector2 m_PlacedDesiredSize {};
     bool m_Clip { false };
+
+    // Measurements are taken from const functions.
+    mutable MeasureCache m_MeasureCache {};
+    mutable HitIndex m_HitIndex {};
 };
 
 }
@@ -38,6 +38,19 @@ SOFTWARE.
 namespace OctaneGUI
 {
 
+// Lets the closest container know that the bounds of one of its children have changed.
+static void InvalidateHitIndex(const Control* Item)
+{
+    for (; Item != nullptr; Item = Item->GetParent())
+    {
+        if (Item->IsContainer())
+        {
+            Item->AsContainer()->InvalidateHitIndex();
+            return;
+        }
+    }
+}
+
 Expand ToExpand(const std::string& Value, Expand Default = Expand::None)
 {
     const std::string Lower = String::ToLower(Value);
@@ -83,7 +96,11 @@ Control::~Control()
 
 Control& Control::SetPosition(const Vector2& Position)
 {
-    m_Bounds.SetPosition(Position);
+    if (Position != m_Bounds.Min)
+    {
+        m_Bounds.SetPosition(Position);
+        InvalidateHitIndex(m_Parent);
+    }
     return *this;
 }
 
@@ -108,6 +125,7 @@ Control& Control::SetSize(const Vector2& Size)
     m_Bounds.Max = m_Bounds.Min + Size;
     if (LastSize != Size)
     {
+        InvalidateHitIndex(this);
         Invalidate(InvalidateType::Layout);
         OnResized();
     }
@@ -130,6 +148,21 @@ Control* Control::GetParent() const
     return m_Parent;
 }
 
+bool Control::IsContainer() const
+{
+    return m_IsContainer;
+}
+
+Container* Control::AsContainer()
+{
+    return m_IsContainer ? static_cast<Container*>(this) : nullptr;
+}
+
+const Container* Control::AsContainer() const
+{
+    return m_IsContainer ? static_cast<const Container*>(this) : nullptr;
+}
+
 Control& Control::SetExpand(Expand InExpand)
 {
     if (IsFixedSize())
@@ -220,9 +253,15 @@ Rect Control::GetAbsoluteBounds() const
     return Result;
 }
 
+const Rect& Control::PaintedBounds() const
+{
+    return m_PaintedBounds;
+}
+
 void Control::SetWindow(Window* InWindow)
 {
     m_Window = InWindow;
+    InvalidatePaintCache();
 }
 
 Window* Control::GetWindow() const
@@ -268,6 +307,31 @@ Control& Control::SetOnInvalidate(OnInvalidateSignature Fn)
 
 Control& Control::Invalidate(InvalidateType Type)
 {
+    // Parents may paint this control as part of their own geometry and measure it as part
+    // of their own size.
+    const bool IsLayout = Type != InvalidateType::Paint;
+    for (Control const* Item = this; Item != nullptr; Item = Item->m_Parent)
+    {
+        Item->InvalidatePaintCache();
+
+        if (IsLayout)
+        {
+            Item->InvalidateMeasureCache();
+        }
+    }
+
+    if (IsLayout)
+    {
+        for (Control* Item = this; Item != nullptr; Item = Item->m_Parent)
+        {
+            if (Item->IsContainer())
+            {
+                Item->MarkLayoutDirty();
+                break;
+            }
+        }
+    }
+
     if (m_OnInvalidate)
     {
         m_OnInvalidate(Share(), Type);
@@ -285,7 +349,9 @@ Control& Control::SetProperty(ThemeProperties::Property Property, const Variant&
 
     Assert(Property < ThemeProperties::Max, "Invalid property index given! Property: %d Max: %d", (int)Property, (int)ThemeProperties::Max);
     m_ThemeProperties[Property] = Value;
+    InvalidateDescendantCaches();
     OnThemeLoaded();
+    Invalidate(InvalidateType::Layout);
 
     return *this;
 }
@@ -307,7 +373,14 @@ const Variant& Control::GetProperty(ThemeProperties::Property Property) const
 
 Control& Control::ClearProperty(ThemeProperties::Property Property)
 {
+    if (!m_ThemeProperties.Has(Property))
+    {
+        return *this;
+    }
+
     m_ThemeProperties.Clear(Property);
+    InvalidateDescendantCaches();
+    Invalidate(InvalidateType::Layout);
     return *this;
 }
 
@@ -360,6 +433,51 @@ Control& Control::SetOnUnfocused(OnControlSignature&& Fn)
     return *this;
 }
 
+Control& Control::SetCachePaint(bool CachePaint)
+{
+    m_CachePaint = CachePaint;
+    InvalidatePaintCache();
+    return *this;
+}
+
+bool Control::ShouldCachePaint() const
+{
+    return m_CachePaint;
+}
+
+void Control::DoPaint(Paint& Brush) const
+{
+    const Rect Bounds = GetAbsoluteBounds();
+    m_PaintedBounds = Bounds;
+
+    if (!m_CachePaint || m_Window == nullptr)
+    {
+        OnPaint(Brush);
+        return;
+    }
+
+    const Rect Clip = Brush.GetClip();
+    const uint32_t Generation = m_Window->PaintGeneration();
+
+    if (m_PaintCache.Valid
+        && m_PaintCache.Bounds == Bounds
+        && m_PaintCache.Clip == Clip
+        && m_PaintCache.Generation == Generation)
+    {
+        Brush.Replay(m_PaintCache.Geometry);
+        return;
+    }
+
+    Brush.BeginCapture();
+    OnPaint(Brush);
+    Brush.EndCapture(m_PaintCache.Geometry);
+
+    m_PaintCache.Bounds = Bounds;
+    m_PaintCache.Clip = Clip;
+    m_PaintCache.Generation = Generation;
+    m_PaintCache.Valid = true;
+}
+
 void Control::OnPaint(Paint&) const
 {
 }
@@ -495,6 +613,8 @@ void Control::Invalidate(std::shared_ptr<Control> Focus, InvalidateType Type) co
         return;
     }
 
+    Focus->InvalidatePaintCache();
+
     if (m_OnInvalidate)
     {
         m_OnInvalidate(Focus, Type);
@@ -506,8 +626,38 @@ bool Control::IsFixedSize() const
     return false;
 }
 
+void Control::InvalidateMeasureCache() const
+{
+}
+
+void Control::MarkLayoutDirty()
+{
+}
+
 Control::Control()
 {
 }
 
+void Control::InvalidatePaintCache() const
+{
+    m_PaintCache.Valid = false;
+}
+
+void Control::InvalidateDescendantCaches() const
+{
+    const Container* Self = AsContainer();
+    if (Self == nullptr)
+    {
+        return;
+    }
+
+    for (size_t I = 0; I < Self->NumControls(); I++)
+    {
+        const std::shared_ptr<Control>& Item = Self->Get(I);
+        Item->InvalidatePaintCache();
+        Item->InvalidateMeasureCache();
+        Item->InvalidateDescendantCaches();
+    }
+}
+
 }
@@ -32,6 +32,7 @@ SOFTWARE.
 #include "../Mouse.h"
 #include "../Rect.h"
 #include "../ThemeProperties.h"
+#include "../VertexBuffer.h"
 
 #include <algorithm>
 #include <functional>
@@ -41,6 +42,7 @@ SOFTWARE.
 namespace OctaneGUI
 {
 
+class Container;
 class Json;
 class Menu;
 class Paint;
@@ -119,6 +121,16 @@ public:
     /// @return Pointer to the parent control. May be NULL.
     Control* GetParent() const;
 
+    /// @brief Determines if this control is a Container. This is a flag set on construction
+    /// and is much cheaper than a dynamic cast when walking the control tree.
+    /// @return True if this control is a Container.
+    bool IsContainer() const;
+
+    /// @brief Returns this control as a Container without using RTTI.
+    /// @return Pointer to this control as a Container. NULL if this control is not a Container.
+    Container* AsContainer();
+    const Container* AsContainer() const;
+
     /// @brief Sets the Expand type for this control.
     ///
     /// The Expand type tells the owning Container how this control should be sized during
@@ -206,6 +218,11 @@ public:
     /// @return The Rect that defines the absolute bounds for this control.
     Rect GetAbsoluteBounds() const;
 
+    /// @brief The absolute bounds this control covered the last time it was painted. This is
+    /// the area that needs to be repainted when the control moves or shrinks.
+    /// @return The Rect last painted, or an empty Rect if the control has not been painted.
+    const Rect& PaintedBounds() const;
+
     /// @brief Sets the owning window for this control.
     ///
     /// This function is defined to be virtual as some controls may need to perform
@@ -333,6 +350,25 @@ public:
     /// @return The Control object for chaining methods.
     Control& SetOnUnfocused(OnControlSignature&& Fn);
 
+    /// @brief Sets whether the geometry painted by this control is cached between paints.
+    ///
+    /// When enabled, the geometry from the last OnPaint call is copied into the brush
+    /// as long as this control has not been invalidated or moved. Containers do not
+    /// cache their geometry since their children may change without notifying them.
+    ///
+    /// @param CachePaint Boolean to set whether painting should be cached.
+    /// @return This Control reference.
+    Control& SetCachePaint(bool CachePaint);
+
+    /// @brief Returns whether this control caches its painted geometry.
+    /// @return Boolean value.
+    bool ShouldCachePaint() const;
+
+    /// @brief Paints this control into the given brush, replaying the cached
+    /// geometry if it is still valid.
+    /// @param Brush The object to add painting commands to.
+    void DoPaint(Paint& Brush) const;
+
     /// @brief Notifies the control to paint into a given brush.
     ///
     /// This is called for all controls of a given Window when a repaint request
@@ -391,9 +427,34 @@ protected:
 
     virtual bool IsFixedSize() const;
 
+    /// @brief Called on this control and all of its parents when a layout is invalidated so
+    /// that any cached measurements can be discarded.
+    virtual void InvalidateMeasureCache() const;
+
+    /// @brief Called on the closest container to a control whose layout was invalidated, so
+    /// that the next layout of its parents does not skip it.
+    virtual void MarkLayoutDirty();
+
 private:
+    friend class Container;
+
+    struct PaintCache
+    {
+    public:
+        VertexBuffer::Capture Geometry {};
+        Rect Bounds {};
+        Rect Clip {};
+        uint32_t Generation { 0 };
+        bool Valid { false };
+    };
+
     Control();
 
+    void InvalidatePaintCache() const;
+
+    // Theme properties are inherited, so a change can affect how any descendant paints or measures.
+    void InvalidateDescendantCaches() const;
+
     Window* m_Window { nullptr };
     Control* m_Parent { nullptr };
     Rect m_Bounds {};
@@ -408,6 +469,12 @@ private:
 
     bool m_ForwardKeyEvents { false };
     bool m_ForwardMouseEvents { false };
+    bool m_CachePaint { true };
+    bool m_IsContainer { false };
+
+    // OnPaint is const, so the cache is updated from within const functions.
+    mutable PaintCache m_PaintCache {};
+    mutable Rect m_PaintedBounds {};
 };
 
 }
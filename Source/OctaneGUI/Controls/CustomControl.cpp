@@ -32,6 +32,8 @@ namespace OctaneGUI
 CustomControl::CustomControl(Window* InWindow)
     : Control(InWindow)
 {
+    // The paint callback may draw anything, so the geometry is not assumed to be stable.
+    SetCachePaint(false);
 }
 
 CustomControl& CustomControl::SetOnPaint(OnPaintSignature&& Fn)
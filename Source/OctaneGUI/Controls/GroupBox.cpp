@@ -60,7 +60,7 @@ const char32_t* GroupBox::GetText() const
 
 Vector2 GroupBox::DesiredSize() const
 {
-    Vector2 Result = m_Margins->DesiredSize();
+    Vector2 Result = m_Margins->CachedDesiredSize();
     const float LeftOffset = m_Text->GetPosition().X;
     const float TextWidth = m_Text->GetSize().X + LeftOffset;
     if (Result.X < TextWidth)
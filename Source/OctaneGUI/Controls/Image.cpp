@@ -50,6 +50,7 @@ Image& Image::SetTexture(const char* Path)
     if (Path == nullptr)
     {
         m_Texture = nullptr;
+        Invalidate();
         return *this;
     }
 
@@ -84,12 +85,14 @@ Image& Image::SetUVs(const Rect& UVs)
 {
     m_UVs = UVs;
     SetSize(m_UVs.GetSize());
+    Invalidate();
     return *this;
 }
 
 Image& Image::SetTint(const Color& Tint)
 {
     m_Tint = Tint;
+    Invalidate();
     return *this;
 }
 
@@ -300,7 +300,7 @@ ListBox& ListBox::SetOnSelect(OnSelectSignature Fn)
 
 Vector2 ListBox::ListSize() const
 {
-    return m_List->DesiredSize();
+    return m_List->CachedDesiredSize();
 }
 
 const std::shared_ptr<Control>& ListBox::Item(size_t Index) const
@@ -38,6 +38,7 @@ MarginContainer::MarginContainer(Window* InWindow)
 MarginContainer& MarginContainer::SetMargins(const Rect& Margins)
 {
     m_Margins = Margins;
+    Invalidate(InvalidateType::Layout);
     return *this;
 }
 
@@ -53,10 +54,10 @@ Vector2 MarginContainer::DesiredSize() const
     for (const std::shared_ptr<Control>& Item : Controls())
     {
         Vector2 Size = Item->GetSize();
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Item->AsContainer();
         if (ItemContainer)
         {
-            Size = ItemContainer->DesiredSize();
+            Size = ItemContainer->CachedDesiredSize();
         }
 
         Result.X = std::max<float>(Result.X, Size.X);
@@ -86,10 +87,10 @@ void MarginContainer::PlaceControls(const std::vector<std::shared_ptr<Control>>&
     {
         Vector2 Size = Item->GetSize();
 
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Item->AsContainer();
         if (ItemContainer)
         {
-            Size = ItemContainer->DesiredSize();
+            Size = ItemContainer->CachedDesiredSize();
         }
 
         switch (Item->GetExpand())
@@ -152,10 +152,10 @@ void Menu::Resize()
     {
         Vector2 ItemSize = Item->GetSize();
 
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Item->AsContainer();
         if (ItemContainer)
         {
-            ItemSize = ItemContainer->DesiredSize();
+            ItemSize = ItemContainer->CachedDesiredSize();
         }
 
         if (ItemSize.X > Size.X)
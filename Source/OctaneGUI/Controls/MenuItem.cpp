@@ -66,12 +66,14 @@ MenuItem& MenuItem::DestroyMenu()
 MenuItem& MenuItem::SetIsMenuBar(bool IsMenuBar)
 {
     m_IsMenuBar = IsMenuBar;
+    Invalidate();
     return *this;
 }
 
 MenuItem& MenuItem::SetChecked(bool Checked)
 {
     m_IsChecked = Checked;
+    Invalidate();
     return *this;
 }
 
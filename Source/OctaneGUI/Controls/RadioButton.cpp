@@ -71,7 +71,7 @@ RadioButton& RadioButton::SetSelected(bool Selected)
 
     if (Selected)
     {
-        Container* Parent = dynamic_cast<Container*>(GetParent());
+        Container* Parent = GetParent() != nullptr ? GetParent()->AsContainer() : nullptr;
         if (Parent != nullptr)
         {
             for (const std::shared_ptr<Control>& Item : Parent->Controls())
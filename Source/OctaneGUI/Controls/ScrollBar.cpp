@@ -58,6 +58,7 @@ ScrollBarHandle& ScrollBarHandle::SetHandleSize(float HandleSize)
         ClampOffset();
     }
 
+    Invalidate();
     return *this;
 }
 
@@ -294,9 +294,10 @@ void ScrollableContainer::OnPaint(Paint& Brush) const
     {
         if (Item != m_HorizontalSB && Item != m_VerticalSB)
         {
-            if (!Brush.IsClipped(Item->GetAbsoluteBounds()))
+            const Rect Bounds = Item->GetAbsoluteBounds();
+            if (!Brush.IsClipped(Bounds) && Brush.IsDamaged(Bounds))
             {
-                Item->OnPaint(Brush);
+                Item->DoPaint(Brush);
             }
         }
     }
@@ -391,10 +392,10 @@ Vector2 ScrollableContainer::GetContentSize(const std::vector<std::shared_ptr<Co
         if (Item != m_HorizontalSB && Item != m_VerticalSB && !m_HorizontalSB->HasControl(Item) && !m_VerticalSB->HasControl(Item))
         {
             Vector2 Size = Item->GetSize();
-            const std::shared_ptr<Container> ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+            Container* ItemContainer = Item->AsContainer();
             if (ItemContainer)
             {
-                Size = ItemContainer->DesiredSize();
+                Size = ItemContainer->CachedDesiredSize();
             }
 
             Result.X = std::max<float>(Result.X, Size.X);
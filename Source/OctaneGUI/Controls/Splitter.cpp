@@ -278,7 +278,7 @@ std::weak_ptr<Control> Splitter::GetControl(const Vector2& Point) const
 
 Vector2 Splitter::DesiredSize() const
 {
-    return m_Split->DesiredSize();
+    return m_Split->CachedDesiredSize();
 }
 
 Control& Splitter::SetOnCreateContextMenu(Control::OnCreateContextMenuSignature&& Fn)
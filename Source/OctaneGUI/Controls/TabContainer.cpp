@@ -165,7 +165,7 @@ public:
     virtual Vector2 DesiredSize() const override
     {
         const Vector2 Padding { GetProperty(ThemeProperties::Tab_Padding).Vector() };
-        return m_Margins->DesiredSize() + Padding * 2.0f;
+        return m_Margins->CachedDesiredSize() + Padding * 2.0f;
     }
 
     virtual std::weak_ptr<Control> GetControl(const Vector2& Point) const override
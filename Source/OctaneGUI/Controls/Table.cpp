@@ -194,7 +194,7 @@ public:
 
     virtual Vector2 DesiredSize() const override
     {
-        return m_Rows->DesiredSize();
+        return m_Rows->CachedDesiredSize();
     }
 
 private:
@@ -353,7 +353,7 @@ std::weak_ptr<Control> Table::GetControl(const Vector2& Point) const
 
 Vector2 Table::DesiredSize() const
 {
-    Vector2 Result { m_Contents->DesiredSize() };
+    Vector2 Result { m_Contents->CachedDesiredSize() };
     if (GetExpand() == Expand::Width || GetExpand() == Expand::Both)
     {
         Result.X = GetSize().X;
@@ -122,6 +122,7 @@ float Text::FontSize() const
 Text& Text::SetWrap(bool Wrap)
 {
     m_Wrap = Wrap;
+    Invalidate();
     return *this;
 }
 
@@ -133,16 +134,24 @@ bool Text::Wrap() const
 void Text::PushSpan(const TextSpan& Span)
 {
     m_Spans.push_back(Span);
+    Invalidate(InvalidateType::Paint);
 }
 
 void Text::PushSpans(const std::vector<TextSpan>& Spans)
 {
     m_Spans.insert(m_Spans.end(), Spans.begin(), Spans.end());
+    Invalidate(InvalidateType::Paint);
 }
 
 void Text::ClearSpans()
 {
+    if (m_Spans.empty())
+    {
+        return;
+    }
+
     m_Spans.clear();
+    Invalidate(InvalidateType::Paint);
 }
 
 void Text::Update()
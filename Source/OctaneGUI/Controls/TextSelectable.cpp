@@ -49,6 +49,7 @@ TextSelectable::~TextSelectable()
 TextSelectable& TextSelectable::SetSelected(bool Selected)
 {
     m_Selected = Selected;
+    Invalidate();
     return *this;
 }
 
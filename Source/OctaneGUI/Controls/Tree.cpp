@@ -561,11 +561,11 @@ std::weak_ptr<Control> Tree::GetControl(const Vector2& Point) const
 
 Vector2 Tree::DesiredSize() const
 {
-    Vector2 Result = m_Item->DesiredSize();
+    Vector2 Result = m_Item->CachedDesiredSize();
 
     if (m_List && m_Expand)
     {
-        const Vector2 Size = m_List->DesiredSize();
+        const Vector2 Size = m_List->CachedDesiredSize();
         Result.X = std::max<float>(Result.X, m_List->GetPosition().X + Size.X);
         Result.Y += Size.Y;
     }
@@ -0,0 +1,100 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "DispatchQueue.h"
+
+namespace OctaneGUI
+{
+
+DispatchQueue::DispatchQueue()
+{
+    m_Tail = new Node();
+    m_Head.store(m_Tail, std::memory_order_relaxed);
+}
+
+DispatchQueue::~DispatchQueue()
+{
+    while (m_Tail != nullptr)
+    {
+        Node* Next = m_Tail->Next.load(std::memory_order_relaxed);
+        delete m_Tail;
+        m_Tail = Next;
+    }
+}
+
+void DispatchQueue::Push(OnDispatchSignature&& Fn)
+{
+    Node* Item = new Node();
+    Item->Fn = std::move(Fn);
+
+    // Counted before linking so the size never drops below the number of linked nodes.
+    m_Size.fetch_add(1, std::memory_order_acq_rel);
+    Node* Previous = m_Head.exchange(Item, std::memory_order_acq_rel);
+    Previous->Next.store(Item, std::memory_order_release);
+}
+
+size_t DispatchQueue::Run()
+{
+    // Bound the number of functions so that a function which posts another one can not
+    // keep the consumer running forever.
+    const size_t Count = m_Size.load(std::memory_order_acquire);
+
+    size_t Result = 0;
+    OnDispatchSignature Fn { nullptr };
+    while (Result < Count && Pop(Fn))
+    {
+        Result++;
+        Fn();
+    }
+
+    return Result;
+}
+
+bool DispatchQueue::IsEmpty() const
+{
+    return m_Size.load(std::memory_order_acquire) == 0;
+}
+
+bool DispatchQueue::Pop(OnDispatchSignature& Fn)
+{
+    // A producer may have swapped the head without linking its node yet. That node is
+    // picked up by the next call.
+    Node* Next = m_Tail->Next.load(std::memory_order_acquire);
+    if (Next == nullptr)
+    {
+        return false;
+    }
+
+    Fn = std::move(Next->Fn);
+    Next->Fn = nullptr;
+    delete m_Tail;
+    m_Tail = Next;
+    m_Size.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+}
+
+}
@@ -0,0 +1,80 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+
+namespace OctaneGUI
+{
+
+/// @brief Queue of functions posted from any thread and run by a single consumer thread.
+///
+/// Producers link new nodes with a single atomic exchange, so Push never blocks. Only one
+/// thread may call Run at a time.
+class DispatchQueue
+{
+public:
+    typedef std::function<void()> OnDispatchSignature;
+
+    DispatchQueue();
+    ~DispatchQueue();
+
+    DispatchQueue(const DispatchQueue&) = delete;
+    DispatchQueue& operator=(const DispatchQueue&) = delete;
+
+    /// @brief Adds a function to the queue. This is safe to call from any thread.
+    void Push(OnDispatchSignature&& Fn);
+
+    /// @brief Runs the functions that were queued before this call, in the order they were
+    /// pushed. Functions pushed while running are left for the next call.
+    ///
+    /// @return The number of functions that were run.
+    size_t Run();
+
+    bool IsEmpty() const;
+
+private:
+    struct Node
+    {
+    public:
+        std::atomic<Node*> Next { nullptr };
+        OnDispatchSignature Fn { nullptr };
+    };
+
+    bool Pop(OnDispatchSignature& Fn);
+
+    // Producers push to the head while the consumer pops from the tail. The tail always
+    // points to a node whose function has already been consumed.
+    std::atomic<Node*> m_Head { nullptr };
+    Node* m_Tail { nullptr };
+    std::atomic<size_t> m_Size { 0 };
+};
+
+}
@@ -38,6 +38,14 @@ DrawCommand::DrawCommand(uint32_t VertexOffset, uint32_t IndexOffset, uint32_t I
 {
 }
 
+DrawCommand DrawCommand::Primitives(uint32_t VertexOffset, uint32_t IndexOffset, uint32_t PrimitiveOffset, Rect Clip)
+{
+    DrawCommand Result(VertexOffset, IndexOffset, 0, 0, Clip);
+    Result.m_Primitive = true;
+    Result.m_PrimitiveOffset = PrimitiveOffset;
+    return Result;
+}
+
 uint32_t DrawCommand::VertexOffset() const
 {
     return m_VertexOffset;
@@ -63,6 +71,33 @@ Rect DrawCommand::Clip() const
     return m_Clip;
 }
 
+bool DrawCommand::IsPrimitive() const
+{
+    return m_Primitive;
+}
+
+uint32_t DrawCommand::PrimitiveOffset() const
+{
+    return m_PrimitiveOffset;
+}
+
+uint32_t DrawCommand::PrimitiveCount() const
+{
+    return m_PrimitiveCount;
+}
+
+DrawCommand& DrawCommand::Extend(uint32_t IndexCount)
+{
+    m_IndexCount += IndexCount;
+    return *this;
+}
+
+DrawCommand& DrawCommand::ExtendPrimitives(uint32_t PrimitiveCount)
+{
+    m_PrimitiveCount += PrimitiveCount;
+    return *this;
+}
+
 DrawCommand::DrawCommand()
     : m_VertexOffset(0)
     , m_IndexOffset(0)
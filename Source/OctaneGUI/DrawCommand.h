@@ -39,11 +39,21 @@ public:
     DrawCommand(uint32_t VertexOffset, uint32_t IndexOffset, uint32_t IndexCount, uint32_t TextureID, Rect Clip);
     ~DrawCommand();
 
+    /// @brief Creates a command that draws a range of primitive instances instead of indexed
+    /// triangles. The vertex and index offsets mark where the command sits in those buffers.
+    static DrawCommand Primitives(uint32_t VertexOffset, uint32_t IndexOffset, uint32_t PrimitiveOffset, Rect Clip);
+
     uint32_t VertexOffset() const;
     uint32_t IndexOffset() const;
     uint32_t IndexCount() const;
     uint32_t TextureID() const;
     Rect Clip() const;
+    bool IsPrimitive() const;
+    uint32_t PrimitiveOffset() const;
+    uint32_t PrimitiveCount() const;
+
+    DrawCommand& Extend(uint32_t IndexCount);
+    DrawCommand& ExtendPrimitives(uint32_t PrimitiveCount);
 
 private:
     DrawCommand();
@@ -53,6 +63,9 @@ private:
     uint32_t m_IndexCount;
     uint32_t m_TextureID;
     Rect m_Clip;
+    bool m_Primitive { false };
+    uint32_t m_PrimitiveOffset { 0 };
+    uint32_t m_PrimitiveCount { 0 };
 };
 
 }
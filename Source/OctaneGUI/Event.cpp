@@ -130,6 +130,34 @@ const char* Event::Name() const
     return ToString(m_Type);
 }
 
+Event& Event::SetTimestamp(int64_t Timestamp)
+{
+    m_Timestamp = Timestamp;
+    return *this;
+}
+
+int64_t Event::Timestamp() const
+{
+    return m_Timestamp;
+}
+
+bool Event::IsInput() const
+{
+    switch (m_Type)
+    {
+    case Type::KeyPressed:
+    case Type::KeyReleased:
+    case Type::MouseMoved:
+    case Type::MousePressed:
+    case Type::MouseReleased:
+    case Type::MouseWheel:
+    case Type::Text: return true;
+    default: break;
+    }
+
+    return false;
+}
+
 Event::Event()
     : m_Type(Type::None)
 {
@@ -177,11 +177,20 @@ public:
     const Data& GetData() const;
     const char* Name() const;
 
+    /// @brief Sets when the event was received from the OS in Clock::Timestamp microseconds.
+    /// Events without a time stamp are stamped when the Application receives them.
+    Event& SetTimestamp(int64_t Timestamp);
+    int64_t Timestamp() const;
+
+    /// @brief Whether the event comes from the keyboard or mouse.
+    bool IsInput() const;
+
 private:
     Event();
 
     Type m_Type;
     Data m_Data;
+    int64_t m_Timestamp { 0 };
 };
 
 }
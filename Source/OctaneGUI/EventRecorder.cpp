@@ -0,0 +1,414 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "EventRecorder.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace OctaneGUI
+{
+
+static const char Magic[4] = { 'O', 'G', 'E', 'R' };
+static const uint32_t Version = 1;
+
+// Tag written in place of a time stamp to declare the ID of the next window index.
+static const uint32_t WindowTag = UINT32_MAX;
+
+template <typename T>
+static void Write(std::ofstream& Stream, const T& Value)
+{
+    Stream.write(reinterpret_cast<const char*>(&Value), sizeof(T));
+}
+
+template <typename T>
+static bool Read(const std::vector<char>& Buffer, size_t& Offset, T& Value)
+{
+    if (Offset + sizeof(T) > Buffer.size())
+    {
+        return false;
+    }
+
+    std::memcpy(&Value, Buffer.data() + Offset, sizeof(T));
+    Offset += sizeof(T);
+    return true;
+}
+
+static void WriteVector(std::ofstream& Stream, const Vector2& Value)
+{
+    Write(Stream, Value.X);
+    Write(Stream, Value.Y);
+}
+
+static bool ReadVector(const std::vector<char>& Buffer, size_t& Offset, Vector2& Value)
+{
+    return Read(Buffer, Offset, Value.X) && Read(Buffer, Offset, Value.Y);
+}
+
+EventRecorder::EventRecorder()
+{
+}
+
+EventRecorder::~EventRecorder()
+{
+    Close();
+}
+
+bool EventRecorder::Open(const char* Path)
+{
+    Close();
+
+    m_Stream.open(Path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!m_Stream.is_open())
+    {
+        return false;
+    }
+
+    m_Stream.write(Magic, sizeof(Magic));
+    Write(m_Stream, Version);
+    m_Windows.clear();
+    m_Clock.Reset();
+    return true;
+}
+
+void EventRecorder::Close()
+{
+    if (m_Stream.is_open())
+    {
+        m_Stream.close();
+    }
+}
+
+bool EventRecorder::IsOpen() const
+{
+    return m_Stream.is_open();
+}
+
+void EventRecorder::Record(const char* WindowID, const Event& E)
+{
+    if (!m_Stream.is_open())
+    {
+        return;
+    }
+
+    const uint8_t Window = WindowIndex(WindowID);
+    Write(m_Stream, (uint32_t)m_Clock.MeasureMS());
+    Write(m_Stream, Window);
+    Write(m_Stream, (uint8_t)E.GetType());
+
+    const Event::Data& Data = E.GetData();
+    switch (E.GetType())
+    {
+    case Event::Type::KeyPressed:
+    case Event::Type::KeyReleased: Write(m_Stream, (uint16_t)Data.m_Key.m_Code); break;
+
+    case Event::Type::MouseMoved: WriteVector(m_Stream, Data.m_MouseMove.m_Position); break;
+
+    case Event::Type::MousePressed:
+    case Event::Type::MouseReleased:
+    {
+        Write(m_Stream, (uint8_t)Data.m_MouseButton.m_Button);
+        Write(m_Stream, (uint8_t)Data.m_MouseButton.m_Count);
+        WriteVector(m_Stream, Data.m_MouseButton.m_Position);
+    }
+    break;
+
+    case Event::Type::MouseWheel:
+    {
+        Write(m_Stream, (int32_t)Data.m_MouseWheel.Delta.X);
+        Write(m_Stream, (int32_t)Data.m_MouseWheel.Delta.Y);
+    }
+    break;
+
+    case Event::Type::Text: Write(m_Stream, Data.m_Text.Code); break;
+
+    case Event::Type::WindowResized: WriteVector(m_Stream, Data.m_Resized.m_Size); break;
+
+    case Event::Type::WindowMoved:
+    case Event::Type::WindowMaximized: WriteVector(m_Stream, Data.m_Moved.m_Position); break;
+
+    default: break;
+    }
+}
+
+uint8_t EventRecorder::WindowIndex(const char* WindowID)
+{
+    for (size_t I = 0; I < m_Windows.size(); I++)
+    {
+        if (m_Windows[I] == WindowID)
+        {
+            return (uint8_t)I;
+        }
+    }
+
+    const uint8_t Result = (uint8_t)m_Windows.size();
+    m_Windows.push_back(WindowID);
+
+    const std::string& ID = m_Windows.back();
+    Write(m_Stream, WindowTag);
+    Write(m_Stream, (uint16_t)ID.size());
+    m_Stream.write(ID.data(), ID.size());
+    return Result;
+}
+
+EventPlayer::EventPlayer()
+{
+}
+
+bool EventPlayer::Load(const char* Path)
+{
+    m_Windows.clear();
+    m_Records.clear();
+    m_Next = 0;
+    m_Loaded = false;
+
+    std::ifstream Stream;
+    Stream.open(Path, std::ios_base::in | std::ios_base::binary);
+    if (!Stream.is_open())
+    {
+        return false;
+    }
+
+    Stream.seekg(0, std::ios_base::end);
+    const size_t FileSize = static_cast<size_t>(Stream.tellg());
+    Stream.seekg(0, std::ios_base::beg);
+
+    std::vector<char> Buffer;
+    Buffer.resize(FileSize);
+    Stream.read(Buffer.data(), Buffer.size());
+    Stream.close();
+
+    size_t Offset = 0;
+    uint32_t FileVersion = 0;
+    if (Buffer.size() < sizeof(Magic) || std::memcmp(Buffer.data(), Magic, sizeof(Magic)) != 0)
+    {
+        return false;
+    }
+
+    Offset += sizeof(Magic);
+    if (!Read(Buffer, Offset, FileVersion) || FileVersion != Version)
+    {
+        return false;
+    }
+
+    while (Offset < Buffer.size())
+    {
+        uint32_t Time = 0;
+        if (!Read(Buffer, Offset, Time))
+        {
+            return false;
+        }
+
+        if (Time == WindowTag)
+        {
+            uint16_t Length = 0;
+            if (!Read(Buffer, Offset, Length) || Offset + Length > Buffer.size())
+            {
+                return false;
+            }
+
+            m_Windows.emplace_back(Buffer.data() + Offset, Length);
+            Offset += Length;
+            continue;
+        }
+
+        uint8_t Window = 0;
+        uint8_t Type = 0;
+        if (!Read(Buffer, Offset, Window) || !Read(Buffer, Offset, Type) || Window >= m_Windows.size())
+        {
+            return false;
+        }
+
+        bool Valid = true;
+        Record Item;
+        Item.Time = Time;
+        Item.Window = Window;
+        switch ((Event::Type)Type)
+        {
+        case Event::Type::KeyPressed:
+        case Event::Type::KeyReleased:
+        {
+            uint16_t Code = 0;
+            Valid = Read(Buffer, Offset, Code);
+            Item.Item = Event((Event::Type)Type, Event::Key((Keyboard::Key)Code));
+        }
+        break;
+
+        case Event::Type::MouseMoved:
+        {
+            Vector2 Position;
+            Valid = ReadVector(Buffer, Offset, Position);
+            Item.Item = Event(Event::MouseMove(Position.X, Position.Y));
+        }
+        break;
+
+        case Event::Type::MousePressed:
+        case Event::Type::MouseReleased:
+        {
+            uint8_t Button = 0;
+            uint8_t Count = 0;
+            Vector2 Position;
+            Valid = Read(Buffer, Offset, Button) && Read(Buffer, Offset, Count) && ReadVector(Buffer, Offset, Position);
+            Item.Item = Event((Event::Type)Type, Event::MouseButton((Mouse::Button)Button, Position.X, Position.Y, (Mouse::Count)Count));
+        }
+        break;
+
+        case Event::Type::MouseWheel:
+        {
+            int32_t X = 0;
+            int32_t Y = 0;
+            Valid = Read(Buffer, Offset, X) && Read(Buffer, Offset, Y);
+            Item.Item = Event(Event::MouseWheel(X, Y));
+        }
+        break;
+
+        case Event::Type::Text:
+        {
+            uint32_t Code = 0;
+            Valid = Read(Buffer, Offset, Code);
+            Item.Item = Event(Event::Text(Code));
+        }
+        break;
+
+        case Event::Type::WindowResized:
+        {
+            Vector2 Size;
+            Valid = ReadVector(Buffer, Offset, Size);
+            Item.Item = Event(Event::WindowResized(Size.X, Size.Y));
+        }
+        break;
+
+        case Event::Type::WindowMoved:
+        case Event::Type::WindowMaximized:
+        {
+            Vector2 Position;
+            Valid = ReadVector(Buffer, Offset, Position);
+            Item.Item = Event((Event::Type)Type, Event::WindowMoved(Position));
+        }
+        break;
+
+        default:
+        {
+            Valid = Type <= (uint8_t)Event::Type::WindowRepaint;
+            Item.Item = Event((Event::Type)Type);
+        }
+        break;
+        }
+
+        if (!Valid)
+        {
+            return false;
+        }
+
+        m_Records.push_back(Item);
+    }
+
+    m_Loaded = true;
+    m_Clock.Reset();
+    return true;
+}
+
+bool EventPlayer::IsLoaded() const
+{
+    return m_Loaded;
+}
+
+void EventPlayer::Start()
+{
+    m_Next = 0;
+    m_Clock.Reset();
+}
+
+Event EventPlayer::Next(const char* WindowID)
+{
+    if (m_Next >= m_Records.size())
+    {
+        return Event(Event::Type::None);
+    }
+
+    const Record& Item = m_Records[m_Next];
+    if (m_Windows[Item.Window] != WindowID || (int64_t)Item.Time > m_Clock.MeasureMS())
+    {
+        return Event(Event::Type::None);
+    }
+
+    m_Next++;
+    return Item.Item;
+}
+
+size_t EventPlayer::SkipUnavailable(const std::function<bool(const char*)>& IsAvailable)
+{
+    size_t Skipped = 0;
+    while (m_Next < m_Records.size())
+    {
+        const Record& Item = m_Records[m_Next];
+        const std::string& WindowID = m_Windows[Item.Window];
+        if ((int64_t)Item.Time > m_Clock.MeasureMS() || IsAvailable(WindowID.c_str()))
+        {
+            break;
+        }
+
+        printf("Skipping replayed event for unavailable window '%s'.\n", WindowID.c_str());
+        m_Next++;
+        Skipped++;
+    }
+
+    return Skipped;
+}
+
+int EventPlayer::NextDeadline() const
+{
+    if (m_Next >= m_Records.size())
+    {
+        return -1;
+    }
+
+    return (int)std::max<int64_t>((int64_t)m_Records[m_Next].Time - m_Clock.MeasureMS(), 0);
+}
+
+bool EventPlayer::IsFinished() const
+{
+    return m_Next >= m_Records.size();
+}
+
+float EventPlayer::Elapsed() const
+{
+    return m_Clock.Measure();
+}
+
+size_t EventPlayer::Played() const
+{
+    return m_Next;
+}
+
+size_t EventPlayer::Count() const
+{
+    return m_Records.size();
+}
+
+}
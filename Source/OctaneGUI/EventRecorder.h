@@ -0,0 +1,121 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#pragma once
+
+#include "Clock.h"
+#include "Event.h"
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+/// @brief Writes events received by the Application to a compact binary file.
+///
+/// Each record stores the number of milliseconds since recording started, the index of the
+/// target window and the event type followed by only the fields used by that type. A window's
+/// ID is written once, the first time it receives an event. Values are stored in the host's
+/// byte order.
+class EventRecorder
+{
+public:
+    EventRecorder();
+    ~EventRecorder();
+
+    bool Open(const char* Path);
+    void Close();
+    bool IsOpen() const;
+
+    void Record(const char* WindowID, const Event& E);
+
+private:
+    uint8_t WindowIndex(const char* WindowID);
+
+    std::ofstream m_Stream {};
+    std::vector<std::string> m_Windows {};
+    Clock m_Clock {};
+};
+
+/// @brief Plays back a file written by EventRecorder.
+///
+/// Events are returned in the order they were recorded, once the same amount of time has
+/// passed since Start was called. An event is only returned for the window it was recorded for,
+/// so windows receive their events in the same order as the recording.
+class EventPlayer
+{
+public:
+    EventPlayer();
+
+    bool Load(const char* Path);
+    bool IsLoaded() const;
+
+    /// @brief Starts the playback clock. Events are due relative to this call.
+    void Start();
+
+    /// @brief Returns the next event if it is due and targets the given window. Otherwise, an
+    /// event of type None is returned.
+    Event Next(const char* WindowID);
+
+    /// @brief Skips due events that target a window which is not available, such as one that
+    /// was never created or is hidden, so that playback does not stall on them.
+    ///
+    /// @param IsAvailable Returns true if the window with the given ID receives events.
+    /// @return The number of events skipped.
+    size_t SkipUnavailable(const std::function<bool(const char*)>& IsAvailable);
+
+    /// @brief Number of milliseconds until the next event is due, or -1 if playback has finished.
+    int NextDeadline() const;
+
+    bool IsFinished() const;
+
+    /// @brief Number of seconds since playback started.
+    float Elapsed() const;
+    size_t Played() const;
+    size_t Count() const;
+
+private:
+    struct Record
+    {
+    public:
+        uint32_t Time { 0 };
+        uint8_t Window { 0 };
+        Event Item { Event::Type::None };
+    };
+
+    std::vector<std::string> m_Windows {};
+    std::vector<Record> m_Records {};
+    size_t m_Next { 0 };
+    bool m_Loaded { false };
+    Clock m_Clock {};
+};
+
+}
@@ -0,0 +1,144 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "Histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace OctaneGUI
+{
+
+#define SUB_BUCKET_BITS 4
+#define SUB_BUCKETS (1 << SUB_BUCKET_BITS)
+#define BUCKET_COUNT (SUB_BUCKETS + (64 - SUB_BUCKET_BITS) * SUB_BUCKETS)
+
+static uint32_t HighestBit(uint64_t Value)
+{
+    uint32_t Result = 0;
+    while (Value >>= 1)
+    {
+        Result++;
+    }
+
+    return Result;
+}
+
+Histogram::Histogram()
+{
+    m_Buckets.resize(BUCKET_COUNT, 0);
+}
+
+void Histogram::Add(int64_t Value)
+{
+    Value = std::max<int64_t>(Value, 0);
+
+    m_Buckets[Bucket((uint64_t)Value)]++;
+    m_Min = m_Count == 0 ? Value : std::min<int64_t>(m_Min, Value);
+    m_Max = m_Count == 0 ? Value : std::max<int64_t>(m_Max, Value);
+    m_Sum += (double)Value;
+    m_Count++;
+}
+
+void Histogram::Reset()
+{
+    std::fill(m_Buckets.begin(), m_Buckets.end(), 0);
+    m_Count = 0;
+    m_Min = 0;
+    m_Max = 0;
+    m_Sum = 0.0;
+}
+
+uint64_t Histogram::Count() const
+{
+    return m_Count;
+}
+
+int64_t Histogram::Min() const
+{
+    return m_Min;
+}
+
+int64_t Histogram::Max() const
+{
+    return m_Max;
+}
+
+double Histogram::Mean() const
+{
+    return m_Count == 0 ? 0.0 : m_Sum / (double)m_Count;
+}
+
+int64_t Histogram::Percentile(float Percent) const
+{
+    if (m_Count == 0)
+    {
+        return 0;
+    }
+
+    const float Clamped = std::min<float>(std::max<float>(Percent, 0.0f), 100.0f);
+    const uint64_t Target = std::max<uint64_t>((uint64_t)std::ceil((double)Clamped / 100.0 * (double)m_Count), 1);
+
+    uint64_t Total = 0;
+    for (size_t I = 0; I < m_Buckets.size(); I++)
+    {
+        Total += m_Buckets[I];
+        if (Total >= Target)
+        {
+            return std::min<int64_t>((int64_t)BucketMax(I), m_Max);
+        }
+    }
+
+    return m_Max;
+}
+
+size_t Histogram::Bucket(uint64_t Value)
+{
+    if (Value < SUB_BUCKETS)
+    {
+        return (size_t)Value;
+    }
+
+    const uint32_t Shift = HighestBit(Value) - SUB_BUCKET_BITS;
+    const size_t Sub = (size_t)((Value >> Shift) & (SUB_BUCKETS - 1));
+    return SUB_BUCKETS + Shift * SUB_BUCKETS + Sub;
+}
+
+uint64_t Histogram::BucketMax(size_t Index)
+{
+    if (Index < SUB_BUCKETS)
+    {
+        return Index;
+    }
+
+    const uint32_t Shift = (uint32_t)((Index - SUB_BUCKETS) / SUB_BUCKETS);
+    const uint64_t Sub = (Index - SUB_BUCKETS) % SUB_BUCKETS;
+    const uint64_t Lower = (SUB_BUCKETS + Sub) << Shift;
+    return Lower + ((uint64_t)1 << Shift) - 1;
+}
+
+}
@@ -0,0 +1,70 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+/// @brief Records the distribution of non-negative integer samples in log-linear buckets.
+///
+/// Values below 16 are counted exactly. Larger values share a bucket with values that have the
+/// same 4 most significant bits after the leading bit, so percentiles are within about 6% of
+/// the recorded value while using a fixed amount of memory.
+class Histogram
+{
+public:
+    Histogram();
+
+    void Add(int64_t Value);
+    void Reset();
+
+    uint64_t Count() const;
+    int64_t Min() const;
+    int64_t Max() const;
+    double Mean() const;
+
+    /// @brief Returns the largest value of the bucket that contains the given percentile.
+    /// @param Percent Value in the range [0, 100].
+    int64_t Percentile(float Percent) const;
+
+private:
+    static size_t Bucket(uint64_t Value);
+    static uint64_t BucketMax(size_t Index);
+
+    std::vector<uint64_t> m_Buckets {};
+    uint64_t m_Count { 0 };
+    int64_t m_Min { 0 };
+    int64_t m_Max { 0 };
+    double m_Sum { 0.0 };
+};
+
+}
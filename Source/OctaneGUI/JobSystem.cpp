@@ -0,0 +1,256 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "JobSystem.h"
+#include "Application.h"
+
+#include <algorithm>
+
+namespace OctaneGUI
+{
+
+// Identifies the worker running on the current thread so that jobs submitted from within a
+// job are pushed to the same worker.
+static thread_local const JobSystem* t_Owner { nullptr };
+static thread_local size_t t_WorkerIndex { 0 };
+
+JobSystem::CancellationToken::CancellationToken()
+    : m_Cancelled(std::make_shared<std::atomic<bool>>(false))
+{
+}
+
+void JobSystem::CancellationToken::Cancel() const
+{
+    m_Cancelled->store(true, std::memory_order_release);
+}
+
+bool JobSystem::CancellationToken::IsCancelled() const
+{
+    return m_Cancelled->load(std::memory_order_acquire);
+}
+
+JobSystem::JobSystem(Application& App)
+    : m_Application(App)
+{
+}
+
+JobSystem::~JobSystem()
+{
+    Shutdown();
+}
+
+void JobSystem::Initialize(int Workers)
+{
+    Shutdown();
+
+    if (Workers < 0)
+    {
+        Workers = std::max<int>((int)std::thread::hardware_concurrency(), 1);
+    }
+
+    m_Running = true;
+    for (int I = 0; I < Workers; I++)
+    {
+        m_Workers.push_back(std::make_unique<Worker>());
+    }
+
+    // Threads are started once all workers exist since they steal from each other.
+    for (size_t I = 0; I < m_Workers.size(); I++)
+    {
+        m_Workers[I]->Thread = std::thread(&JobSystem::Run, this, I);
+    }
+}
+
+void JobSystem::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> Lock(m_SleepLock);
+        m_Running = false;
+    }
+    m_Wake.notify_all();
+
+    for (const std::unique_ptr<Worker>& Item : m_Workers)
+    {
+        if (Item->Thread.joinable())
+        {
+            Item->Thread.join();
+        }
+    }
+
+    // Jobs that never started are dropped.
+    m_Workers.clear();
+    for (std::deque<Job>& Jobs : m_Injected)
+    {
+        Jobs.clear();
+    }
+    m_Pending = 0;
+}
+
+uint32_t JobSystem::Workers() const
+{
+    return (uint32_t)m_Workers.size();
+}
+
+JobSystem::CancellationToken JobSystem::Submit(OnWorkSignature&& Work, OnEmptySignature&& OnComplete, Priority Level, const CancellationToken& Token)
+{
+    Job Item;
+    Item.Work = std::move(Work);
+    Item.OnComplete = std::move(OnComplete);
+    Item.Token = Token;
+
+    if (m_Workers.empty())
+    {
+        Execute(Item);
+        return Token;
+    }
+
+    // The job is counted before it can be taken so the count never drops below zero. The sleep
+    // lock is held so that a worker can not miss the notification between checking the count
+    // and waiting.
+    {
+        std::lock_guard<std::mutex> Lock(m_SleepLock);
+        m_Pending++;
+    }
+
+    if (t_Owner == this)
+    {
+        Worker& Self = *m_Workers[t_WorkerIndex];
+        std::lock_guard<std::mutex> Lock(Self.Lock);
+        Self.Jobs[(size_t)Level].push_back(std::move(Item));
+    }
+    else
+    {
+        std::lock_guard<std::mutex> Lock(m_InjectLock);
+        m_Injected[(size_t)Level].push_back(std::move(Item));
+    }
+    m_Wake.notify_one();
+
+    return Token;
+}
+
+void JobSystem::Run(size_t Index)
+{
+    t_Owner = this;
+    t_WorkerIndex = Index;
+
+    while (true)
+    {
+        Job Item;
+        if (Take(Index, Item))
+        {
+            m_Pending--;
+            Execute(Item);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> Lock(m_SleepLock);
+        m_Wake.wait(Lock, [this]() -> bool
+            {
+                return !m_Running || m_Pending > 0;
+            });
+
+        if (!m_Running)
+        {
+            break;
+        }
+    }
+
+    t_Owner = nullptr;
+}
+
+bool JobSystem::Take(size_t Index, Job& Result)
+{
+    for (size_t Level = 0; Level < (size_t)Priority::Count; Level++)
+    {
+        // Take the newest job from this worker first since its data is most likely cached.
+        {
+            Worker& Self = *m_Workers[Index];
+            std::lock_guard<std::mutex> Lock(Self.Lock);
+            std::deque<Job>& Jobs = Self.Jobs[Level];
+            if (!Jobs.empty())
+            {
+                Result = std::move(Jobs.back());
+                Jobs.pop_back();
+                return true;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> Lock(m_InjectLock);
+            std::deque<Job>& Jobs = m_Injected[Level];
+            if (!Jobs.empty())
+            {
+                Result = std::move(Jobs.front());
+                Jobs.pop_front();
+                return true;
+            }
+        }
+
+        for (size_t I = 1; I < m_Workers.size(); I++)
+        {
+            Worker& Victim = *m_Workers[(Index + I) % m_Workers.size()];
+            std::lock_guard<std::mutex> Lock(Victim.Lock);
+            std::deque<Job>& Jobs = Victim.Jobs[Level];
+            if (!Jobs.empty())
+            {
+                Result = std::move(Jobs.front());
+                Jobs.pop_front();
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void JobSystem::Execute(Job& Item)
+{
+    if (Item.Token.IsCancelled())
+    {
+        return;
+    }
+
+    if (Item.Work)
+    {
+        Item.Work(Item.Token);
+    }
+
+    if (!Item.OnComplete)
+    {
+        return;
+    }
+
+    m_Application.Post([Token = Item.Token, OnComplete = std::move(Item.OnComplete)]() -> void
+        {
+            if (!Token.IsCancelled())
+            {
+                OnComplete();
+            }
+        });
+}
+
+}
@@ -0,0 +1,135 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#pragma once
+
+#include "CallbackDefs.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+class Application;
+
+/// @brief Pool of worker threads owned by the Application for work that should not block the
+/// main thread.
+///
+/// Jobs submitted from outside the pool are queued in submission order. Jobs submitted from
+/// within a job are pushed to the running worker's own deque, which it takes from newest first
+/// while idle workers steal the oldest. Higher priority jobs are always taken before lower
+/// priority ones. Completion callbacks are posted to the Application and run on the main
+/// thread during RunFrame.
+class JobSystem
+{
+public:
+    enum class Priority : uint8_t
+    {
+        High,
+        Normal,
+        Low,
+        Count,
+    };
+
+    /// @brief Shared flag used to cancel one or more jobs. Work that has not started is
+    /// skipped, running work may poll IsCancelled, and completion callbacks are not invoked
+    /// once a job is cancelled.
+    class CancellationToken
+    {
+    public:
+        CancellationToken();
+
+        void Cancel() const;
+        bool IsCancelled() const;
+
+    private:
+        std::shared_ptr<std::atomic<bool>> m_Cancelled { nullptr };
+    };
+
+    typedef std::function<void(const CancellationToken&)> OnWorkSignature;
+
+    JobSystem(Application& App);
+    ~JobSystem();
+
+    /// @brief Starts the worker threads.
+    ///
+    /// @param Workers Number of worker threads. A negative value uses the number of hardware
+    /// threads. With no workers, jobs run immediately on the submitting thread.
+    void Initialize(int Workers);
+    void Shutdown();
+    uint32_t Workers() const;
+
+    /// @brief Queues work to run on a worker thread. This may be called from any thread,
+    /// including from within a job.
+    ///
+    /// @param Work The function to run on a worker thread.
+    /// @param OnComplete Optional function to run on the main thread once the work is done.
+    /// @param Level Jobs with a higher priority are started first.
+    /// @param Token Token to cancel the job with. The same token may be shared between jobs.
+    /// @return The token for the job.
+    CancellationToken Submit(OnWorkSignature&& Work, OnEmptySignature&& OnComplete = nullptr, Priority Level = Priority::Normal, const CancellationToken& Token = CancellationToken());
+
+private:
+    struct Job
+    {
+    public:
+        OnWorkSignature Work { nullptr };
+        OnEmptySignature OnComplete { nullptr };
+        CancellationToken Token {};
+    };
+
+    struct Worker
+    {
+    public:
+        std::mutex Lock {};
+        std::deque<Job> Jobs[(size_t)Priority::Count] {};
+        std::thread Thread {};
+    };
+
+    void Run(size_t Index);
+    bool Take(size_t Index, Job& Result);
+    void Execute(Job& Item);
+
+    Application& m_Application;
+    std::vector<std::unique_ptr<Worker>> m_Workers {};
+    std::mutex m_InjectLock {};
+    std::deque<Job> m_Injected[(size_t)Priority::Count] {};
+    std::atomic<bool> m_Running { false };
+    std::atomic<uint32_t> m_Pending { 0 };
+    std::mutex m_SleepLock {};
+    std::condition_variable m_Wake {};
+};
+
+}
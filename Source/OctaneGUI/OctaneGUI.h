@@ -66,18 +66,25 @@ SOFTWARE.
 #include "Controls/WindowContainer.h"
 #include "Defines.h"
 #include "Dialogs/FileDialog.h"
+#include "DispatchQueue.h"
 #include "DrawCommand.h"
 #include "Event.h"
+#include "EventRecorder.h"
 #include "FileSystem.h"
 #include "FlyString.h"
 #include "Font.h"
+#include "Histogram.h"
+#include "JobSystem.h"
 #include "Json.h"
 #include "Keyboard.h"
 #include "LanguageServer.h"
 #include "Mouse.h"
 #include "Network.h"
 #include "Paint.h"
+#include "Path.h"
+#include "Primitive.h"
 #include "Rect.h"
+#include "ScratchArena.h"
 #include "Socket.h"
 #include "String.h"
 #include "Theme.h"
@@ -86,4 +93,5 @@ SOFTWARE.
 #include "Vector2.h"
 #include "Vertex.h"
 #include "VertexBuffer.h"
+#include "VertexLayout.h"
 #include "Window.h"
@@ -25,6 +25,7 @@ SOFTWARE.
 */
 
 #include "Paint.h"
+#include "Path.h"
 #include "Application.h"
 #include "Font.h"
 #include "Rect.h"
@@ -32,49 +33,110 @@ SOFTWARE.
 #include "Texture.h"
 #include "Theme.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 
 #define PI 3.14159265358979323846f
 
-#define RECT_INDEX_COUNT(Count) Count * 6
-#define CIRCLE_INDEX_COUNT(Steps) Steps * 3
+#define RECT_INDEX_COUNT(Count) (Count) * 6
+#define CIRCLE_INDEX_COUNT(Steps) (Steps) * 3
+
+// Longest a miter join may be relative to half of the line thickness before it is beveled.
+#define MITER_LIMIT 4.0f
 
 namespace OctaneGUI
 {
 
-std::vector<Vector2> GetArcPoints(const Vector2& Center, float Radius, float StartAngle, float EndAngle, int Steps)
+// Number of points in the precomputed unit circle. Automatic step counts are powers of two
+// up to this size so that their points can be read directly from the table.
+static constexpr int UnitCircleSize = 256;
+static constexpr int MinCircleSteps = 8;
+
+// Largest distance in pixels allowed between a tessellated edge and the true circle.
+static constexpr float CircleTolerance = 0.25f;
+
+static const std::array<Vector2, UnitCircleSize>& UnitCircle()
 {
-    const float Rad = PI / 180;
-    const float Delta = Rad * (EndAngle - StartAngle);
-    const float Start = Rad * StartAngle;
+    static const std::array<Vector2, UnitCircleSize> Result = []() -> std::array<Vector2, UnitCircleSize>
+    {
+        std::array<Vector2, UnitCircleSize> Table;
+        for (int I = 0; I < UnitCircleSize; I++)
+        {
+            const float Angle = (2.0f * PI * I) / UnitCircleSize;
+            Table[I] = { std::cos(Angle), std::sin(Angle) };
+        }
+        return Table;
+    }();
 
-    std::vector<Vector2> Result;
-    Result.resize(Steps + 1);
+    return Result;
+}
 
-    for (int I = 0; I <= Steps; I++)
+// Number of segments for an arc so that the tessellation stays within CircleTolerance. Radii
+// are already in device pixels since controls apply the render scale before painting.
+static int ArcSteps(float Radius, float StartAngle, float EndAngle)
+{
+    int Steps = MinCircleSteps;
+    if (Radius > CircleTolerance)
     {
-        const float Pct = ((float)I / (float)(Steps - 1));
-        const float Angle = Pct * Delta + Start;
-        const Vector2 Point { std::roundf(std::cos(Angle) * Radius), std::roundf(std::sin(Angle) * Radius) };
-        Result[I] = Center + Point;
+        const float Needed = PI / std::acos(1.0f - CircleTolerance / Radius);
+        while (Steps < UnitCircleSize && (float)Steps < Needed)
+        {
+            Steps *= 2;
+        }
     }
 
-    return Result;
+    const float Fraction = std::abs(EndAngle - StartAngle) / 360.0f;
+    return std::max((int)std::ceil(Steps * Fraction), 1);
 }
 
-std::vector<Vector2> GetCirclePoints(const Vector2& Center, float Radius, int Steps)
+// Calls Callback with each of the Steps + 1 points along an arc. Angles are in degrees.
+template <typename Fn>
+static void ForEachArcPoint(const Vector2& Center, float Radius, float StartAngle, float EndAngle, int Steps, Fn&& Callback)
 {
-    const float Delta = (2.0f * PI) / Steps;
+    const float TableStep = 360.0f / UnitCircleSize;
+    const float Start = StartAngle / TableStep;
+    const float Stride = (EndAngle - StartAngle) / TableStep / Steps;
 
-    std::vector<Vector2> Result;
-    Result.resize(Steps + 1);
+    if (std::floor(Start) == Start && std::floor(Stride) == Stride)
+    {
+        const std::array<Vector2, UnitCircleSize>& Table = UnitCircle();
+        for (int I = 0; I <= Steps; I++)
+        {
+            int Index = ((int)Start + I * (int)Stride) % UnitCircleSize;
+            if (Index < 0)
+            {
+                Index += UnitCircleSize;
+            }
+
+            const Vector2& Point = Table[Index];
+            Callback(Center + Vector2 { std::roundf(Point.X * Radius), std::roundf(Point.Y * Radius) });
+        }
+
+        return;
+    }
 
+    // The angles do not line up with the table. Rotate the first point by a fixed delta instead.
+    const float Rad = PI / 180.0f;
+    const float Delta = Rad * (EndAngle - StartAngle) / Steps;
+    const Vector2 Rotation { std::cos(Delta), std::sin(Delta) };
+    Vector2 Point { std::cos(Rad * StartAngle), std::sin(Rad * StartAngle) };
     for (int I = 0; I <= Steps; I++)
     {
-        const float Angle = I * Delta;
-        Result[I] = { Center.X + std::roundf(std::cos(Angle) * Radius), Center.Y + std::roundf(std::sin(Angle) * Radius) };
+        Callback(Center + Vector2 { std::roundf(Point.X * Radius), std::roundf(Point.Y * Radius) });
+        Point = { Point.X * Rotation.X - Point.Y * Rotation.Y, Point.X * Rotation.Y + Point.Y * Rotation.X };
     }
+}
 
+static Primitive RectanglePrimitive(const Rect& Bounds, const Rect& Radius, const Color& Fill, const Color& Border, const Color& BorderShadow, float Thickness)
+{
+    Primitive Result;
+    Result.Bounds = Bounds;
+    Result.Radius = Radius;
+    Result.Fill = Fill;
+    Result.Border = Border;
+    Result.BorderShadow = BorderShadow;
+    Result.Thickness = Thickness;
     return Result;
 }
 
@@ -91,20 +153,50 @@ Paint::~Paint()
 {
 }
 
+void Paint::Clear()
+{
+    m_ClipStack.clear();
+    m_Damage.clear();
+    m_Buffer.Clear();
+}
+
 void Paint::Line(const Vector2& Start, const Vector2& End, const Color& Col, float Thickness)
 {
+    if (m_UsePrimitives)
+    {
+        Primitive Instance;
+        Instance.Bounds = { Start, End };
+        Instance.Fill = Col;
+        Instance.Thickness = Thickness;
+        Instance.Shape = Primitive::Type::Line;
+        AddPrimitive(Instance);
+        return;
+    }
+
     PushCommand(6, 0);
     AddLine(Start, End, Col, Thickness);
 }
 
 void Paint::Rectangle(const Rect& Bounds, const Color& Col)
 {
+    if (m_UsePrimitives)
+    {
+        AddPrimitive(RectanglePrimitive(Bounds, {}, Col, Col, Col, 0.0f));
+        return;
+    }
+
     PushCommand(6, 0);
     AddTriangles(Bounds, Col);
 }
 
 void Paint::Rectangle3D(const Rect& Bounds, const Color& Base, const Color& Highlight, const Color& Shadow, bool Sunken)
 {
+    if (m_UsePrimitives)
+    {
+        AddPrimitive(RectanglePrimitive(Bounds, {}, Base, Sunken ? Shadow : Highlight, Sunken ? Highlight : Shadow, 1.0f));
+        return;
+    }
+
     Rectangle(Bounds, Base);
 
     const float Thickness = Sunken ? 1.0f : 1.0f;
@@ -125,6 +217,12 @@ void Paint::Rectangle3D(const Rect& Bounds, const Color& Base, const Color& High
 
 void Paint::Rectangle3DRounded(const Rect& Bounds, const Rect& Radius, const Color& Base, const Color& Highlight, const Color& Shadow, bool Sunken)
 {
+    if (m_UsePrimitives)
+    {
+        AddPrimitive(RectanglePrimitive(Bounds, Radius, Base, Sunken ? Shadow : Highlight, Sunken ? Highlight : Shadow, 1.0f));
+        return;
+    }
+
     RectangleRounded(Bounds, Base, Radius);
 
     const float RadiusTL = Radius.Min.X;
@@ -147,18 +245,32 @@ void Paint::Rectangle3DRounded(const Rect& Bounds, const Rect& Radius, const Col
 
 void Paint::RectangleOutline(const Rect& Bounds, const Color& Col, float Thickness)
 {
-    const Vector2 TopRight(Bounds.Min + Vector2(Bounds.GetSize().X, 0.0f));
-    const Vector2 BottomLeft(Bounds.Min + Vector2(0.0f, Bounds.GetSize().Y));
+    if (m_UsePrimitives)
+    {
+        // The outline is centered on the edges of the bounds.
+        const Vector2 HalfThickness { Thickness * 0.5f, Thickness * 0.5f };
+        AddPrimitive(RectanglePrimitive({ Bounds.Min - HalfThickness, Bounds.Max + HalfThickness }, {}, {}, Col, Col, Thickness));
+        return;
+    }
+
+    const Vector2 Corners[4] {
+        Bounds.Min,
+        { Bounds.Max.X, Bounds.Min.Y },
+        Bounds.Max,
+        { Bounds.Min.X, Bounds.Max.Y },
+    };
 
-    PushCommand(6 * 4, 0);
-    AddLine(Bounds.Min, TopRight, Col, Thickness, 0);
-    AddLine(TopRight, Bounds.Max, Col, Thickness, 4);
-    AddLine(Bounds.Max, BottomLeft, Col, Thickness, 8);
-    AddLine(BottomLeft, Bounds.Min, Col, Thickness, 12);
+    Polyline(Corners, 4, Col, Thickness, true);
 }
 
 void Paint::RectangleRounded(const Rect& Bounds, const Color& Col, const Rect& Radius)
 {
+    if (m_UsePrimitives)
+    {
+        AddPrimitive(RectanglePrimitive(Bounds, Radius, Col, Col, Col, 0.0f));
+        return;
+    }
+
     const float Left = Bounds.Min.X;
     const float Top = Bounds.Min.Y;
     const float Right = Bounds.Max.X;
@@ -175,8 +287,11 @@ void Paint::RectangleRounded(const Rect& Bounds, const Color& Col, const Rect& R
     Vector2 Max {};
 
     // 5 Rectangles and 4 arcs.
-    const int Steps = 32;
-    uint32_t IndexCount = RECT_INDEX_COUNT(5) + CIRCLE_INDEX_COUNT(Steps) * 4;
+    const int StepsTL = RadiusTL > 0.0f ? ArcSteps(RadiusTL, 180.0f, 270.0f) : 0;
+    const int StepsTR = RadiusTR > 0.0f ? ArcSteps(RadiusTR, 270.0f, 360.0f) : 0;
+    const int StepsBR = RadiusBR > 0.0f ? ArcSteps(RadiusBR, 0.0f, 90.0f) : 0;
+    const int StepsBL = RadiusBL > 0.0f ? ArcSteps(RadiusBL, 90.0f, 180.0f) : 0;
+    uint32_t IndexCount = RECT_INDEX_COUNT(5) + CIRCLE_INDEX_COUNT(StepsTL + StepsTR + StepsBR + StepsBL);
     PushCommand(IndexCount, 0);
 
     // Left Rectangle
@@ -209,30 +324,33 @@ void Paint::RectangleRounded(const Rect& Bounds, const Color& Col, const Rect& R
     AddTriangles({ Min, Max }, Col, Offset);
     Offset += 4;
 
-    Vector2 Center { Left + RadiusTL, Top + RadiusTL };
-    std::vector<Vector2> Vertices = GetArcPoints(Center, RadiusTL, 180.0f, 270.0f, Steps);
-    AddTrianglesCircle(Center, Vertices, Col, Offset);
-    Offset += Steps;
+    if (StepsTL > 0)
+    {
+        Offset += AddArc({ Left + RadiusTL, Top + RadiusTL }, RadiusTL, 180.0f, 270.0f, StepsTL, Col, Offset);
+    }
 
-    Center = { Right - RadiusTR, Top + RadiusTR };
-    Vertices = GetArcPoints(Center, RadiusTR, 270.0f, 360.0f, Steps);
-    AddTrianglesCircle(Center, Vertices, Col, Offset);
-    Offset += Steps;
+    if (StepsTR > 0)
+    {
+        Offset += AddArc({ Right - RadiusTR, Top + RadiusTR }, RadiusTR, 270.0f, 360.0f, StepsTR, Col, Offset);
+    }
 
-    Center = { Right - RadiusBR, Bottom - RadiusBR };
-    Vertices = GetArcPoints(Center, RadiusBR, 0.0f, 90.0f, Steps);
-    AddTrianglesCircle(Center, Vertices, Col, Offset);
-    Offset += Steps;
+    if (StepsBR > 0)
+    {
+        Offset += AddArc({ Right - RadiusBR, Bottom - RadiusBR }, RadiusBR, 0.0f, 90.0f, StepsBR, Col, Offset);
+    }
 
-    Center = { Left + RadiusBL, Bottom - RadiusBL };
-    Vertices = GetArcPoints(Center, RadiusBL, 90.0f, 180.0f, Steps);
-    AddTrianglesCircle(Center, Vertices, Col, Offset);
-    Offset += Steps;
+    if (StepsBL > 0)
+    {
+        AddArc({ Left + RadiusBL, Bottom - RadiusBL }, RadiusBL, 90.0f, 180.0f, StepsBL, Col, Offset);
+    }
 }
 
 void Paint::Text(const std::shared_ptr<Font>& InFont, const Vector2& Position, const std::u32string_view& Contents, const Color& Col)
 {
-    Textf(InFont, Position, Contents, { { 0, Contents.length(), Col } });
+    Vector2 Pos = Position;
+    GlyphBatch Batch;
+    AddGlyphs(InFont, Pos, Position, Contents, Col, true, Batch);
+    FlushGlyphs(Batch);
 }
 
 void Paint::Textf(const std::shared_ptr<Font>& InFont, const Vector2& Position, const std::u32string_view& Contents, const std::vector<TextSpan>& Spans)
@@ -242,31 +360,14 @@ void Paint::Textf(const std::shared_ptr<Font>& InFont, const Vector2& Position,
         return;
     }
 
-    std::vector<std::u32string_view> Views;
-    for (const TextSpan& Item : Spans)
-    {
-        Views.emplace_back(&Contents[Item.Start], Item.End - Item.Start);
-    }
-
-    Rect Clip;
-    if (!m_ClipStack.empty())
-    {
-        Clip = m_ClipStack.back();
-    }
-
-    std::vector<Rect> GlyphRects;
-    std::vector<Rect> GlyphUVs;
-    std::vector<Color> GlyphColors;
     Vector2 Pos = Position;
-    for (size_t I = 0; I < Spans.size(); I++)
+    GlyphBatch Batch;
+    for (const TextSpan& Span : Spans)
     {
-        const TextSpan& Span = Spans[I];
-        const std::u32string_view& View = Views[I];
-        int Count = GatherGlyphs(InFont, Pos, Position, View, GlyphRects, GlyphUVs);
-        GlyphColors.insert(GlyphColors.end(), Count, Span.TextColor);
+        AddGlyphs(InFont, Pos, Position, Contents.substr(Span.Start, Span.End - Span.Start), Span.TextColor, true, Batch);
     }
 
-    AddTriangles(GlyphRects, GlyphUVs, GlyphColors, InFont->ID());
+    FlushGlyphs(Batch);
 }
 
 void Paint::TextWrapped(const std::shared_ptr<Font>& InFont, const Vector2& Position, const std::u32string_view& Contents, const std::vector<TextSpan>& Spans, float Width)
@@ -276,15 +377,11 @@ void Paint::TextWrapped(const std::shared_ptr<Font>& InFont, const Vector2& Posi
         return;
     }
 
-    std::vector<Rect> GlyphRects;
-    std::vector<Rect> GlyphUVs;
-    std::vector<Color> GlyphColors;
-
     size_t Start = 0;
     Vector2 Pos = Position;
+    GlyphBatch Batch;
     for (const TextSpan& Span : Spans)
     {
-        std::vector<std::u32string_view> Views;
         Start = Span.Start;
         for (size_t Index = Span.Start; Index < Span.End; Index++)
         {
@@ -295,29 +392,23 @@ void Paint::TextWrapped(const std::shared_ptr<Font>& InFont, const Vector2& Posi
                 size_t Count = Index - Start;
                 const std::u32string_view View(&Contents[Start], Count);
 
-                std::vector<Rect> Rects;
-                std::vector<Rect> UVs;
-                int Added = GatherGlyphs(InFont, Pos, Position, View, Rects, UVs, false);
-                GlyphColors.insert(GlyphColors.end(), Added, Span.TextColor);
-
-                float CurrentWidth = Pos.X - Position.X;
-                if (CurrentWidth > Width)
+                // Measure the word first so that it can be moved to the next line before its
+                // glyphs are emitted.
+                Vector2 End = Pos;
+                AdvanceGlyphs(InFont, End, Position, View);
+                if (End.X - Position.X > Width)
                 {
-                    Rects.clear();
-                    UVs.clear();
                     Pos.X = Position.X;
                     Pos.Y += InFont->Size();
-                    GatherGlyphs(InFont, Pos, Position, View, Rects, UVs, false);
                 }
 
-                GlyphRects.insert(GlyphRects.end(), Rects.begin(), Rects.end());
-                GlyphUVs.insert(GlyphUVs.end(), UVs.begin(), UVs.end());
+                AddGlyphs(InFont, Pos, Position, View, Span.TextColor, false, Batch);
                 Start = Index;
             }
         }
     }
 
-    AddTriangles(GlyphRects, GlyphUVs, GlyphColors, InFont->ID());
+    FlushGlyphs(Batch);
 }
 
 void Paint::Image(const Rect& Bounds, const Rect& TexCoords, const std::shared_ptr<Texture>& InTexture, const Color& Col)
@@ -333,49 +424,201 @@ void Paint::Image(const Rect& Bounds, const Rect& TexCoords, const std::shared_p
 
 void Paint::Circle(const Vector2& Center, float Radius, const Color& Tint, int Steps)
 {
-    std::vector<Vector2> Vertices = GetCirclePoints(Center, Radius, Steps);
+    if (m_UsePrimitives && Steps <= 0)
+    {
+        const Vector2 Extent { Radius, Radius };
+        AddPrimitive(RectanglePrimitive({ Center - Extent, Center + Extent }, { Extent, Extent }, Tint, Tint, Tint, 0.0f));
+        return;
+    }
 
-    PushCommand(3 * Steps, 0);
-    AddTrianglesCircle(Center, Vertices, Tint, 0);
+    Arc(Center, Radius, 0.0f, 360.0f, Tint, Steps);
 }
 
 void Paint::CircleOutline(const Vector2& Center, float Radius, const Color& Tint, float Thickness, int Steps)
 {
-    std::vector<Vector2> Vertices = GetCirclePoints(Center, Radius, Steps);
+    if (m_UsePrimitives && Steps <= 0)
+    {
+        // The outline is centered on the radius.
+        const float Outer = Radius + Thickness * 0.5f;
+        const Vector2 Extent { Outer, Outer };
+        AddPrimitive(RectanglePrimitive({ Center - Extent, Center + Extent }, { Extent, Extent }, {}, Tint, Tint, Thickness));
+        return;
+    }
 
-    Vector2 Start = Vertices[0];
-    for (size_t I = 1; I < Vertices.size(); I++)
+    if (Steps <= 0)
     {
-        const Vector2& End = Vertices[I];
-        Line(Start, End, Tint, Thickness);
-        Start = End;
+        Steps = ArcSteps(Radius, 0.0f, 360.0f);
     }
 
-    Line(Start, Vertices.front(), Tint, Thickness);
+    GatherArcPoints(Center, Radius, 0.0f, 360.0f, Steps);
+    Polyline(m_ArcPoints, Tint, Thickness, true);
 }
 
 void Paint::Arc(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, int Steps)
 {
-    std::vector<Vector2> Vertices = GetArcPoints(Center, Radius, StartAngle, EndAngle, Steps);
+    if (Steps <= 0)
+    {
+        Steps = ArcSteps(Radius, StartAngle, EndAngle);
+    }
 
-    PushCommand(3 * Steps, 0);
-    AddTrianglesCircle(Center, Vertices, Tint);
+    PushCommand(CIRCLE_INDEX_COUNT(Steps), 0);
+    AddArc(Center, Radius, StartAngle, EndAngle, Steps, Tint, 0);
 }
 
 void Paint::ArcOutline(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, float Thickness, int Steps)
 {
-    std::vector<Vector2> Vertices = GetArcPoints(Center, Radius, StartAngle, EndAngle, Steps);
-    if (Vertices.empty())
+    if (Steps <= 0)
+    {
+        Steps = ArcSteps(Radius, StartAngle, EndAngle);
+    }
+
+    GatherArcPoints(Center, Radius, StartAngle, EndAngle, Steps);
+    Polyline(m_ArcPoints, Tint, Thickness);
+}
+
+void Paint::Polyline(const Vector2* Points, size_t Count, const Color& Col, float Thickness, bool Closed, LineJoin Join)
+{
+    // Repeated points would produce segments without a direction.
+    m_PolylinePoints.clear();
+    for (size_t I = 0; I < Count; I++)
+    {
+        if (m_PolylinePoints.empty() || m_PolylinePoints.back() != Points[I])
+        {
+            m_PolylinePoints.push_back(Points[I]);
+        }
+    }
+
+    if (Closed && m_PolylinePoints.size() > 1 && m_PolylinePoints.back() == m_PolylinePoints.front())
+    {
+        m_PolylinePoints.pop_back();
+    }
+
+    const size_t PointCount = m_PolylinePoints.size();
+    if (PointCount < 2)
     {
         return;
     }
 
-    Vector2 Start = Vertices[0];
-    for (size_t I = 1; I < Vertices.size(); I++)
+    Closed = Closed && PointCount > 2;
+    const size_t SegmentCount = Closed ? PointCount : PointCount - 1;
+    const float HalfThickness = Thickness * 0.5f;
+    const std::vector<Vector2>& Joints = m_PolylinePoints;
+
+    const auto Normal = [&](size_t Segment) -> Vector2
+    {
+        const Vector2 Direction = (Joints[(Segment + 1) % PointCount] - Joints[Segment]).Unit();
+        return { -Direction.Y, Direction.X };
+    };
+
+    // A join is mitered when the miter stays within the limit. Otherwise it is beveled.
+    const auto Miter = [&](const Vector2& In, const Vector2& Out, Vector2& Result) -> bool
+    {
+        const Vector2 Sum = In + Out;
+        const float Length = Sum.Length();
+        if (Join != LineJoin::Miter || Length <= 0.0f)
+        {
+            return false;
+        }
+
+        const Vector2 Direction = Sum / Length;
+        const float Cos = Direction.X * In.X + Direction.Y * In.Y;
+        if (Cos * MITER_LIMIT < 1.0f)
+        {
+            return false;
+        }
+
+        Result = Direction * (HalfThickness / Cos);
+        return true;
+    };
+
+    uint32_t Bevels = 0;
+    Vector2 Unused;
+    for (size_t I = Closed ? 0 : 1; I < (Closed ? PointCount : PointCount - 1); I++)
     {
-        const Vector2& End = Vertices[I];
-        Line(Start, End, Tint, Thickness);
-        Start = End;
+        if (!Miter(Normal((I + SegmentCount - 1) % SegmentCount), Normal(I % SegmentCount), Unused))
+        {
+            Bevels++;
+        }
+    }
+
+    PushCommand(RECT_INDEX_COUNT((uint32_t)SegmentCount + Bevels), 0);
+
+    // Each point has a pair of vertices for the segment ending at it and a pair for the
+    // segment starting at it. They are the same vertices unless the point is beveled.
+    uint32_t Offset = 0;
+    uint32_t FirstIn = 0;
+    uint32_t PreviousOut = 0;
+    for (size_t I = 0; I < PointCount; I++)
+    {
+        const Vector2& Point = Joints[I];
+        const bool HasIn = Closed || I > 0;
+        const bool HasOut = Closed || I + 1 < PointCount;
+        const Vector2 In = HasIn ? Normal((I + SegmentCount - 1) % SegmentCount) : Vector2();
+        const Vector2 Out = HasOut ? Normal(I % SegmentCount) : Vector2();
+
+        uint32_t InPair = Offset;
+        uint32_t OutPair = Offset;
+        Vector2 Extent;
+        if (!HasIn || !HasOut)
+        {
+            Extent = (HasIn ? In : Out) * HalfThickness;
+            m_Buffer.AddVertex(Point + Extent, Col);
+            m_Buffer.AddVertex(Point - Extent, Col);
+            Offset += 2;
+        }
+        else if (Miter(In, Out, Extent))
+        {
+            m_Buffer.AddVertex(Point + Extent, Col);
+            m_Buffer.AddVertex(Point - Extent, Col);
+            Offset += 2;
+        }
+        else
+        {
+            m_Buffer.AddVertex(Point + In * HalfThickness, Col);
+            m_Buffer.AddVertex(Point - In * HalfThickness, Col);
+            m_Buffer.AddVertex(Point + Out * HalfThickness, Col);
+            m_Buffer.AddVertex(Point - Out * HalfThickness, Col);
+            m_Buffer.AddVertex(Point, Col);
+            OutPair = Offset + 2;
+
+            m_Buffer.AddIndex(Offset + 4);
+            m_Buffer.AddIndex(Offset);
+            m_Buffer.AddIndex(Offset + 2);
+            m_Buffer.AddIndex(Offset + 4);
+            m_Buffer.AddIndex(Offset + 1);
+            m_Buffer.AddIndex(Offset + 3);
+            Offset += 5;
+        }
+
+        if (I == 0)
+        {
+            FirstIn = InPair;
+        }
+        else
+        {
+            AddSegmentIndices(PreviousOut, InPair);
+        }
+
+        PreviousOut = OutPair;
+    }
+
+    if (Closed)
+    {
+        AddSegmentIndices(PreviousOut, FirstIn);
+    }
+}
+
+void Paint::Polyline(const std::vector<Vector2>& Points, const Color& Col, float Thickness, bool Closed, LineJoin Join)
+{
+    Polyline(Points.data(), Points.size(), Col, Thickness, Closed, Join);
+}
+
+void Paint::Path(const OctaneGUI::Path& Source, const Color& Col, float Thickness, LineJoin Join)
+{
+    const std::vector<Vector2>& Points = Source.Points();
+    for (const OctaneGUI::Path::Contour& Item : Source.Contours())
+    {
+        Polyline(&Points[Item.Start], Item.Count, Col, Thickness, Item.Closed, Join);
     }
 }
 
@@ -408,6 +651,69 @@ bool Paint::IsClipped(const Rect& Bounds) const
     return !(Clip.Intersects(Bounds) || Clip.Encompasses(Bounds));
 }
 
+void Paint::SetDamage(const std::vector<Rect>& Damage)
+{
+    m_Damage = Damage;
+}
+
+bool Paint::IsDamaged(const Rect& Bounds) const
+{
+    if (m_Damage.empty())
+    {
+        return true;
+    }
+
+    for (const Rect& Item : m_Damage)
+    {
+        if (Item.Intersects(Bounds) || Item.Encompasses(Bounds))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+Rect Paint::GetClip() const
+{
+    return !m_ClipStack.empty() ? m_ClipStack.back() : Rect();
+}
+
+void Paint::BeginCapture()
+{
+    m_Buffer.BeginCapture();
+}
+
+void Paint::EndCapture(VertexBuffer::Capture& Result)
+{
+    m_Buffer.EndCapture(Result);
+}
+
+void Paint::Replay(const VertexBuffer::Capture& Source)
+{
+    m_Buffer.Replay(Source);
+}
+
+void Paint::SetUsePrimitives(bool UsePrimitives)
+{
+    m_UsePrimitives = UsePrimitives;
+}
+
+bool Paint::UsePrimitives() const
+{
+    return m_UsePrimitives;
+}
+
+void Paint::SetCompact(bool Compact)
+{
+    m_Buffer.SetCompact(Compact);
+}
+
+void Paint::Pack()
+{
+    m_Buffer.Pack();
+}
+
 const VertexBuffer& Paint::GetBuffer() const
 {
     return m_Buffer;
@@ -433,57 +739,56 @@ void Paint::AddLine(const Vector2& Start, const Vector2& End, const Color& Col,
 
 void Paint::AddTriangles(const Rect& Vertices, const Color& Col, uint32_t Offset)
 {
-    m_Buffer.AddVertex(Vertices.Min, Col);
-    m_Buffer.AddVertex(Vector2(Vertices.Max.X, Vertices.Min.Y), Col);
-    m_Buffer.AddVertex(Vertices.Max, Col);
-    m_Buffer.AddVertex(Vector2(Vertices.Min.X, Vertices.Max.Y), Col);
-
-    AddTriangleIndices(Offset);
+    const Rect TexCoords;
+    m_Buffer.AddQuads(&Vertices, &TexCoords, &Col, 1, Offset);
 }
 
 void Paint::AddTriangles(const Rect& Vertices, const Rect& TexCoords, const Color& Col, uint32_t Offset)
 {
-    m_Buffer.AddVertex(Vertices.Min, TexCoords.Min, Col);
-    m_Buffer.AddVertex(Vector2(Vertices.Max.X, Vertices.Min.Y), Vector2(TexCoords.Max.X, TexCoords.Min.Y), Col);
-    m_Buffer.AddVertex(Vertices.Max, TexCoords.Max, Col);
-    m_Buffer.AddVertex(Vector2(Vertices.Min.X, Vertices.Max.Y), Vector2(TexCoords.Min.X, TexCoords.Max.Y), Col);
-
-    AddTriangleIndices(Offset);
+    m_Buffer.AddQuads(&Vertices, &TexCoords, &Col, 1, Offset);
 }
 
-void Paint::AddTriangles(const std::vector<Rect>& Rects, const std::vector<Rect>& UVs, const std::vector<Color>& Colors, uint32_t TextureID)
+void Paint::AddTriangles(const Rect* Vertices, const Rect* TexCoords, const Color* Colors, uint32_t Count, uint32_t Offset)
 {
-    if (Rects.empty() || UVs.empty() || Colors.empty())
-    {
-        return;
-    }
+    m_Buffer.AddQuads(Vertices, TexCoords, Colors, Count, Offset);
+}
 
-    PushCommand(6 * (uint32_t)Rects.size(), TextureID);
+uint32_t Paint::AddArc(const Vector2& Center, float Radius, float StartAngle, float EndAngle, int Steps, const Color& Tint, uint32_t Offset)
+{
+    m_Buffer.AddVertex(Center, Tint);
+    ForEachArcPoint(Center, Radius, StartAngle, EndAngle, Steps, [&](const Vector2& Point) -> void
+        {
+            m_Buffer.AddVertex(Point, Tint);
+        });
 
-    uint32_t Offset = 0;
-    for (size_t I = 0; I < Rects.size(); I++)
+    // The first vertex is the center of the fan.
+    for (uint32_t I = 0; I < (uint32_t)Steps; I++)
     {
-        const Rect& Vertices = Rects[I];
-        const Rect& TexCoords = UVs[I];
-        const Color& Color_ = Colors[I];
-
-        AddTriangles(Vertices, TexCoords, Color_, Offset);
-        Offset += 4;
+        m_Buffer.AddIndex(Offset);
+        m_Buffer.AddIndex(Offset + I + 1);
+        m_Buffer.AddIndex(Offset + I + 2);
     }
+
+    return (uint32_t)Steps + 2;
 }
 
-void Paint::AddTrianglesCircle(const Vector2& Center, const std::vector<Vector2>& Vertices, const Color& Tint, uint32_t Offset)
+void Paint::AddSegmentIndices(uint32_t Start, uint32_t End)
 {
-    m_Buffer.AddVertex(Center, Tint);
-    m_Buffer.AddVertices(Vertices, Tint);
+    m_Buffer.AddIndex(Start);
+    m_Buffer.AddIndex(End);
+    m_Buffer.AddIndex(End + 1);
+    m_Buffer.AddIndex(Start);
+    m_Buffer.AddIndex(End + 1);
+    m_Buffer.AddIndex(Start + 1);
+}
 
-    // We subtract 1 due to the zero-th index being the center.
-    for (size_t I = 0; I < Vertices.size() - 1; I++)
-    {
-        m_Buffer.AddIndex(0);
-        m_Buffer.AddIndex(Offset + (uint32_t)I + 1);
-        m_Buffer.AddIndex(Offset + (uint32_t)I + 2);
-    }
+void Paint::GatherArcPoints(const Vector2& Center, float Radius, float StartAngle, float EndAngle, int Steps)
+{
+    m_ArcPoints.clear();
+    ForEachArcPoint(Center, Radius, StartAngle, EndAngle, Steps, [this](const Vector2& Point) -> void
+        {
+            m_ArcPoints.push_back(Point);
+        });
 }
 
 void Paint::AddTriangleIndices(uint32_t Offset)
@@ -496,14 +801,18 @@ void Paint::AddTriangleIndices(uint32_t Offset)
     m_Buffer.AddIndex(Offset + 3);
 }
 
+void Paint::AddPrimitive(const Primitive& Instance)
+{
+    m_Buffer.PushPrimitive(Instance, GetClip());
+}
+
 DrawCommand& Paint::PushCommand(uint32_t IndexCount, uint32_t TextureID)
 {
-    return m_Buffer.PushCommand(IndexCount, TextureID, !m_ClipStack.empty() ? m_ClipStack.back() : Rect());
+    return m_Buffer.PushCommand(IndexCount, TextureID, GetClip());
 }
 
-int Paint::GatherGlyphs(const std::shared_ptr<Font>& InFont, Vector2& Position, const Vector2& Origin, const std::u32string_view& Contents, std::vector<Rect>& Rects, std::vector<Rect>& UVs, bool ShouldClip)
+void Paint::AddGlyphs(const std::shared_ptr<Font>& InFont, Vector2& Position, const Vector2& Origin, const std::u32string_view& Contents, const Color& Col, bool ShouldClip, GlyphBatch& Batch)
 {
-    int Result = 0;
     const Rect Clip = !m_ClipStack.empty() ? m_ClipStack.back() : Rect();
     for (char32_t Char : Contents)
     {
@@ -528,15 +837,65 @@ int Paint::GatherGlyphs(const std::shared_ptr<Font>& InFont, Vector2& Position,
 
         InFont->Draw((uint32_t)Char, Position, Vertices, TexCoords);
 
-        if (!(ShouldClip && IsClipped(Vertices)))
+        if (ShouldClip && IsClipped(Vertices))
+        {
+            continue;
+        }
+
+        Batch.Vertices[Batch.Count] = Vertices;
+        Batch.TexCoords[Batch.Count] = TexCoords;
+        Batch.Colors[Batch.Count] = Col;
+        Batch.TextureID = InFont->ID();
+        Batch.Count++;
+
+        if (Batch.Count == GlyphBatch::Capacity)
         {
-            Result++;
-            Rects.push_back(Vertices);
-            UVs.push_back(TexCoords);
+            FlushGlyphs(Batch);
         }
     }
+}
 
-    return Result;
+void Paint::FlushGlyphs(GlyphBatch& Batch)
+{
+    if (Batch.Count == 0)
+    {
+        return;
+    }
+
+    // Compact commands can only address 65536 vertices, so a long run of glyphs may need
+    // to start a new command.
+    const uint32_t VertexCount = Batch.Count * 4;
+    if (Batch.Command == nullptr
+        || (m_Buffer.IsCompact() && m_Buffer.GetVertexCount() + VertexCount - Batch.Command->VertexOffset() > UINT16_MAX + 1))
+    {
+        Batch.Command = &PushCommand(RECT_INDEX_COUNT(Batch.Count), Batch.TextureID);
+        Batch.Offset = 0;
+    }
+    else
+    {
+        Batch.Command->Extend(RECT_INDEX_COUNT(Batch.Count));
+    }
+
+    AddTriangles(Batch.Vertices, Batch.TexCoords, Batch.Colors, Batch.Count, Batch.Offset);
+    Batch.Offset += VertexCount;
+    Batch.Count = 0;
+}
+
+void Paint::AdvanceGlyphs(const std::shared_ptr<Font>& InFont, Vector2& Position, const Vector2& Origin, const std::u32string_view& Contents) const
+{
+    Rect Vertices;
+    Rect TexCoords;
+    for (char32_t Char : Contents)
+    {
+        if (Char == '\n')
+        {
+            Position.X = Origin.X;
+            Position.Y += InFont->Size();
+            continue;
+        }
+
+        InFont->Draw((uint32_t)Char, Position, Vertices, TexCoords);
+    }
 }
 
 }
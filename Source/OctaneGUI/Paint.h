@@ -39,6 +39,7 @@ namespace OctaneGUI
 
 struct Rect;
 class Font;
+class Path;
 struct TextSpan;
 class Texture;
 class Theme;
@@ -46,10 +47,20 @@ class Theme;
 class Paint
 {
 public:
+    enum class LineJoin : uint8_t
+    {
+        Miter,
+        Bevel,
+    };
+
     Paint();
     Paint(const std::shared_ptr<Theme>& InTheme);
     ~Paint();
 
+    /// @brief Clears all geometry, clip rects, and damage so the brush can be reused for the
+    /// next frame without reallocating its storage.
+    void Clear();
+
     void Line(const Vector2& Start, const Vector2& End, const Color& Col, float Thickness = 1.0f);
     void Rectangle(const Rect& Bounds, const Color& Col);
     void Rectangle3D(const Rect& Bounds, const Color& Base, const Color& Highlight, const Color& Shadow, bool Sunken = false);
@@ -60,14 +71,49 @@ public:
     void Textf(const std::shared_ptr<Font>& InFont, const Vector2& Position, const std::u32string_view& Contents, const std::vector<TextSpan>& Spans);
     void TextWrapped(const std::shared_ptr<Font>& InFont, const Vector2& Position, const std::u32string_view& Contents, const std::vector<TextSpan>& Spans, float Width);
     void Image(const Rect& Bounds, const Rect& TexCoords, const std::shared_ptr<Texture>& InTexture, const Color& Col);
-    void Circle(const Vector2& Center, float Radius, const Color& Tint, int Steps = 64);
-    void CircleOutline(const Vector2& Center, float Radius, const Color& Tint, float Thickness = 1.0f, int Steps = 64);
-    void Arc(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, int Steps = 32);
-    void ArcOutline(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, float Thickness = 1.0f, int Steps = 32);
+
+    // Angles are in degrees. A step count of 0 picks the number of segments from the radius.
+    void Circle(const Vector2& Center, float Radius, const Color& Tint, int Steps = 0);
+    void CircleOutline(const Vector2& Center, float Radius, const Color& Tint, float Thickness = 1.0f, int Steps = 0);
+    void Arc(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, int Steps = 0);
+    void ArcOutline(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, float Thickness = 1.0f, int Steps = 0);
+
+    /// @brief Strokes connected segments through the given points as a single draw command.
+    ///
+    /// Miter joins that would extend past 4 times the half thickness fall back to bevels.
+    void Polyline(const Vector2* Points, size_t Count, const Color& Col, float Thickness = 1.0f, bool Closed = false, LineJoin Join = LineJoin::Miter);
+    void Polyline(const std::vector<Vector2>& Points, const Color& Col, float Thickness = 1.0f, bool Closed = false, LineJoin Join = LineJoin::Miter);
+
+    /// @brief Strokes each contour of the path with Polyline.
+    void Path(const OctaneGUI::Path& Source, const Color& Col, float Thickness = 1.0f, LineJoin Join = LineJoin::Miter);
 
     void PushClip(const Rect& Bounds);
     void PopClip();
     bool IsClipped(const Rect& Bounds) const;
+    Rect GetClip() const;
+
+    /// @brief Restricts painting to controls that intersect the given regions. An empty list
+    /// means the whole window is damaged.
+    void SetDamage(const std::vector<Rect>& Damage);
+    bool IsDamaged(const Rect& Bounds) const;
+
+    void BeginCapture();
+    void EndCapture(VertexBuffer::Capture& Result);
+    void Replay(const VertexBuffer::Capture& Source);
+
+    /// @brief Sets whether shapes are recorded as primitive instances instead of triangles.
+    ///
+    /// Only enable this when the frontend can draw primitives. Otherwise, shapes are
+    /// tessellated into triangles on the CPU. Circles with an explicit step count are
+    /// always tessellated.
+    void SetUsePrimitives(bool UsePrimitives);
+    bool UsePrimitives() const;
+
+    /// @brief Sets whether the buffer is packed into the compact vertex layout.
+    void SetCompact(bool Compact);
+
+    /// @brief Finalizes the buffer for the frontend once all geometry has been painted.
+    void Pack();
 
     const VertexBuffer& GetBuffer() const;
     std::shared_ptr<Theme> GetTheme() const;
@@ -76,16 +122,43 @@ private:
     void AddLine(const Vector2& Start, const Vector2& End, const Color& Col, float Thickness, uint32_t IndexOffset = 0);
     void AddTriangles(const Rect& Vertices, const Color& Col, uint32_t IndexOffset = 0);
     void AddTriangles(const Rect& Vertices, const Rect& TexCoords, const Color& Col, uint32_t IndexOffset = 0);
-    void AddTriangles(const std::vector<Rect>& Rects, const std::vector<Rect>& UVs, const std::vector<Color>& Colors, uint32_t TextureID);
-    void AddTrianglesCircle(const Vector2& Center, const std::vector<Vector2>& Vertices, const Color& Tint, uint32_t Offset = 0);
+    void AddTriangles(const Rect* Vertices, const Rect* TexCoords, const Color* Colors, uint32_t Count, uint32_t IndexOffset = 0);
+    uint32_t AddArc(const Vector2& Center, float Radius, float StartAngle, float EndAngle, int Steps, const Color& Tint, uint32_t Offset);
     void AddTriangleIndices(uint32_t Offset);
+    void AddSegmentIndices(uint32_t Start, uint32_t End);
+    void GatherArcPoints(const Vector2& Center, float Radius, float StartAngle, float EndAngle, int Steps);
+    void AddPrimitive(const Primitive& Instance);
     DrawCommand& PushCommand(uint32_t IndexCount, uint32_t TextureID);
 
-    int GatherGlyphs(const std::shared_ptr<Font>& InFont, Vector2& Position, const Vector2& Origin, const std::u32string_view& Contents, std::vector<Rect>& Rects, std::vector<Rect>& UVs, bool ShouldClip = true);
+    // Glyphs emitted by one text call are staged on the stack and flushed through the batched
+    // quad kernel. They extend a single command that is pushed by the first flush.
+    struct GlyphBatch
+    {
+    public:
+        static constexpr uint32_t Capacity = 64;
+
+        DrawCommand* Command { nullptr };
+        uint32_t Offset { 0 };
+        uint32_t TextureID { 0 };
+        uint32_t Count { 0 };
+        Rect Vertices[Capacity];
+        Rect TexCoords[Capacity];
+        Color Colors[Capacity];
+    };
+
+    void AddGlyphs(const std::shared_ptr<Font>& InFont, Vector2& Position, const Vector2& Origin, const std::u32string_view& Contents, const Color& Col, bool ShouldClip, GlyphBatch& Batch);
+    void FlushGlyphs(GlyphBatch& Batch);
+    void AdvanceGlyphs(const std::shared_ptr<Font>& InFont, Vector2& Position, const Vector2& Origin, const std::u32string_view& Contents) const;
 
     std::shared_ptr<Theme> m_Theme { nullptr };
     std::vector<Rect> m_ClipStack {};
+    std::vector<Rect> m_Damage {};
+    bool m_UsePrimitives { false };
     VertexBuffer m_Buffer {};
+
+    // Scratch storage kept between frames so that outlines do not allocate.
+    std::vector<Vector2> m_ArcPoints {};
+    std::vector<Vector2> m_PolylinePoints {};
 };
 
 }
@@ -0,0 +1,108 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "Path.h"
+
+namespace OctaneGUI
+{
+
+Path::Path()
+{
+}
+
+Path::~Path()
+{
+}
+
+Path& Path::MoveTo(const Vector2& Point)
+{
+    m_Contours.push_back({ m_Points.size(), 1, false });
+    m_Points.push_back(Point);
+    return *this;
+}
+
+Path& Path::LineTo(const Vector2& Point)
+{
+    if (m_Contours.empty() || m_Contours.back().Closed)
+    {
+        return MoveTo(Point);
+    }
+
+    m_Points.push_back(Point);
+    m_Contours.back().Count++;
+    return *this;
+}
+
+Path& Path::BezierTo(const Vector2& Control1, const Vector2& Control2, const Vector2& End, int Steps)
+{
+    if (m_Contours.empty() || m_Contours.back().Closed || Steps <= 0)
+    {
+        return LineTo(End);
+    }
+
+    const Vector2 Start = m_Points.back();
+    for (int I = 1; I <= Steps; I++)
+    {
+        const float T = (float)I / (float)Steps;
+        const float U = 1.0f - T;
+        const float A = U * U * U;
+        const float B = 3.0f * U * U * T;
+        const float C = 3.0f * U * T * T;
+        const float D = T * T * T;
+        LineTo(Start * A + Control1 * B + Control2 * C + End * D);
+    }
+
+    return *this;
+}
+
+Path& Path::Close()
+{
+    if (!m_Contours.empty())
+    {
+        m_Contours.back().Closed = true;
+    }
+
+    return *this;
+}
+
+Path& Path::Clear()
+{
+    m_Points.clear();
+    m_Contours.clear();
+    return *this;
+}
+
+const std::vector<Vector2>& Path::Points() const
+{
+    return m_Points;
+}
+
+const std::vector<Path::Contour>& Path::Contours() const
+{
+    return m_Contours;
+}
+
+}
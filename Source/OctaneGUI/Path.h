@@ -0,0 +1,74 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "Vector2.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+/// @brief A set of contours made of straight segments that can be stroked with Paint::Path.
+///
+/// Curves are flattened into segments as they are added. A path can be cleared and rebuilt
+/// each frame without reallocating.
+class Path
+{
+public:
+    struct Contour
+    {
+    public:
+        size_t Start { 0 };
+        size_t Count { 0 };
+        bool Closed { false };
+    };
+
+    Path();
+    ~Path();
+
+    /// @brief Begins a new contour at the given point.
+    Path& MoveTo(const Vector2& Point);
+    Path& LineTo(const Vector2& Point);
+
+    /// @brief Adds a cubic bezier curve from the last point to End.
+    Path& BezierTo(const Vector2& Control1, const Vector2& Control2, const Vector2& End, int Steps = 16);
+
+    /// @brief Connects the last point of the current contour back to its first point.
+    Path& Close();
+    Path& Clear();
+
+    const std::vector<Vector2>& Points() const;
+    const std::vector<Contour>& Contours() const;
+
+private:
+    std::vector<Vector2> m_Points {};
+    std::vector<Contour> m_Contours {};
+};
+
+}
@@ -0,0 +1,67 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "Color.h"
+#include "Rect.h"
+
+#include <cstdint>
+
+namespace OctaneGUI
+{
+
+/// @brief A shape recorded as a single instance for frontends that can draw it with a
+/// signed distance field instead of triangles.
+struct Primitive
+{
+public:
+    enum class Type : uint32_t
+    {
+        Rectangle,
+        Line,
+    };
+
+    // For lines, Min is the start point and Max is the end point.
+    Rect Bounds {};
+
+    // Corner radii with the same layout RectangleRounded uses: Min.X is the top-left,
+    // Min.Y the top-right, Max.X the bottom-left, and Max.Y the bottom-right.
+    Rect Radius {};
+    Color Fill {};
+
+    // Border facing up and to the left.
+    Color Border {};
+
+    // Border facing down and to the right. Matches Border for flat shapes.
+    Color BorderShadow {};
+
+    // Border thickness for rectangles and the line width for lines.
+    float Thickness { 0.0f };
+    Type Shape { Type::Rectangle };
+};
+
+}
@@ -219,4 +219,14 @@ Rect Rect::Intersection(const Rect& Other) const
     return Result;
 }
 
+Rect Rect::Union(const Rect& Other) const
+{
+    return {
+        std::min<float>(Min.X, Other.Min.X),
+        std::min<float>(Min.Y, Other.Min.Y),
+        std::max<float>(Max.X, Other.Max.X),
+        std::max<float>(Max.Y, Other.Max.Y)
+    };
+}
+
 }
@@ -74,6 +74,7 @@ public:
     bool Encompasses(const Rect& Other) const;
 
     Rect Intersection(const Rect& Other) const;
+    Rect Union(const Rect& Other) const;
 };
 
 }
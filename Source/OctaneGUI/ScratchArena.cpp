@@ -0,0 +1,136 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "ScratchArena.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace OctaneGUI
+{
+
+static size_t AlignUp(size_t Value, size_t Alignment)
+{
+    return (Value + Alignment - 1) & ~(Alignment - 1);
+}
+
+ScratchArena::Scope::Scope(ScratchArena& Arena)
+    : m_Arena(Arena)
+    , m_Block(Arena.m_Block)
+    , m_Offset(Arena.m_Offset)
+{
+}
+
+ScratchArena::Scope::~Scope()
+{
+    m_Arena.m_Block = m_Block;
+    m_Arena.m_Offset = m_Offset;
+}
+
+ScratchArena::ScratchArena(size_t BlockSize)
+    : m_BlockSize(BlockSize)
+{
+}
+
+void* ScratchArena::Allocate(size_t Size, size_t Alignment)
+{
+    assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0);
+
+    if (Size == 0)
+    {
+        Size = 1;
+    }
+
+    while (m_Block < m_Blocks.size())
+    {
+        Block& Current = m_Blocks[m_Block];
+        const uintptr_t Base = reinterpret_cast<uintptr_t>(Current.Data.get());
+        const size_t Offset = AlignUp(Base + m_Offset, Alignment) - Base;
+        if (Offset + Size <= Current.Size)
+        {
+            m_Offset = Offset + Size;
+            return Current.Data.get() + Offset;
+        }
+
+        m_Block++;
+        m_Offset = 0;
+    }
+
+    AddBlock(Size + Alignment);
+    return Allocate(Size, Alignment);
+}
+
+void ScratchArena::Reset()
+{
+    // Merge the blocks so that the next frame fits in a single one.
+    if (m_Blocks.size() > 1)
+    {
+        const size_t Total = Capacity();
+        m_Blocks.clear();
+        m_Block = 0;
+        AddBlock(Total);
+    }
+
+    m_Block = 0;
+    m_Offset = 0;
+}
+
+size_t ScratchArena::Used() const
+{
+    size_t Result = 0;
+    for (size_t I = 0; I < m_Block && I < m_Blocks.size(); I++)
+    {
+        Result += m_Blocks[I].Size;
+    }
+
+    return Result + m_Offset;
+}
+
+size_t ScratchArena::Capacity() const
+{
+    size_t Result = 0;
+    for (const Block& Item : m_Blocks)
+    {
+        Result += Item.Size;
+    }
+
+    return Result;
+}
+
+uint64_t ScratchArena::BlockAllocations() const
+{
+    return m_BlockAllocations;
+}
+
+void ScratchArena::AddBlock(size_t MinSize)
+{
+    const size_t Size = std::max<size_t>(MinSize, std::max<size_t>(m_BlockSize, Capacity()));
+    m_Blocks.push_back({ std::unique_ptr<uint8_t[]>(new uint8_t[Size]), Size });
+    m_BlockAllocations++;
+}
+
+}
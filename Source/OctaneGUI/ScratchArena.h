@@ -0,0 +1,103 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+/// @brief Bump allocator for temporaries that only live for part of a frame.
+///
+/// Memory is handed out from large blocks and is released all at once, either when a Scope
+/// ends or when the owning window resets the arena at the start of an update. If a frame
+/// needs more than one block, the blocks are merged on the next reset so that steady state
+/// frames do not touch the heap.
+class ScratchArena
+{
+public:
+    /// @brief Releases everything allocated within its lifetime when it goes out of scope.
+    class Scope
+    {
+    public:
+        Scope(ScratchArena& Arena);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ScratchArena& m_Arena;
+        size_t m_Block { 0 };
+        size_t m_Offset { 0 };
+    };
+
+    ScratchArena(size_t BlockSize = 16 * 1024);
+
+    void* Allocate(size_t Size, size_t Alignment);
+
+    /// @brief Allocates uninitialized storage for Count objects. Destructors are never run,
+    /// so only trivially destructible types are allowed.
+    template <typename T>
+    T* Allocate(size_t Count)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "Scratch objects are never destroyed.");
+        return static_cast<T*>(Allocate(sizeof(T) * Count, alignof(T)));
+    }
+
+    /// @brief Releases all allocations. Must not be called while a Scope is active.
+    void Reset();
+
+    size_t Used() const;
+    size_t Capacity() const;
+
+    /// @brief Number of blocks that have been requested from the heap.
+    uint64_t BlockAllocations() const;
+
+private:
+    struct Block
+    {
+    public:
+        std::unique_ptr<uint8_t[]> Data { nullptr };
+        size_t Size { 0 };
+    };
+
+    void AddBlock(size_t MinSize);
+
+    std::vector<Block> m_Blocks {};
+    size_t m_Block { 0 };
+    size_t m_Offset { 0 };
+    size_t m_BlockSize { 0 };
+    uint64_t m_BlockAllocations { 0 };
+};
+
+}
@@ -45,6 +45,8 @@ Theme::~Theme()
 
 std::shared_ptr<Font> Theme::GetOrAddFont(const char* Path, float Size)
 {
+    std::lock_guard<std::mutex> Lock(m_FontsLock);
+
     // Use the default font path if no path is specified.
     if (Path == nullptr && m_Fonts.size() > 0)
     {
@@ -70,6 +72,8 @@ std::shared_ptr<Font> Theme::GetOrAddFont(const char* Path, float Size)
 
 std::shared_ptr<Font> Theme::GetFont() const
 {
+    std::lock_guard<std::mutex> Lock(m_FontsLock);
+
     if (m_Fonts.empty())
     {
         return nullptr;
@@ -174,7 +178,10 @@ void Theme::Load(const Json& Root)
 
     Set(ThemeProperties::FontPath, Root["FontPath"]);
 
-    m_Fonts.clear();
+    {
+        std::lock_guard<std::mutex> Lock(m_FontsLock);
+        m_Fonts.clear();
+    }
     GetOrAddFont(m_Properties[ThemeProperties::FontPath].String(), m_Properties[ThemeProperties::FontSize].Float());
 
     if (m_OnThemeLoaded)
@@ -31,6 +31,7 @@ SOFTWARE.
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace OctaneGUI
@@ -45,6 +46,10 @@ public:
     Theme();
     ~Theme();
 
+    /// @brief Finds or loads the font with the given path and size.
+    ///
+    /// Lookups are safe to perform from paint threads. Loading a new font must happen on the
+    /// main thread since it creates a texture through the frontend.
     std::shared_ptr<Font> GetOrAddFont(const char* Path, float Size);
     std::shared_ptr<Font> GetFont() const;
 
@@ -61,6 +66,7 @@ private:
     void Set(ThemeProperties::Property Property, const Variant& Value);
 
     std::vector<std::shared_ptr<Font>> m_Fonts;
+    mutable std::mutex m_FontsLock {};
     ThemeProperties m_Properties {};
     OnEmptySignature m_OnThemeLoaded { nullptr };
 };
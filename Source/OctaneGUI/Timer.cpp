@@ -41,6 +41,11 @@ Timer::Timer(int Interval, bool Repeat, Window* InWindow, OnEmptySignature&& Fn)
 
 Timer::~Timer()
 {
+    // Only a scheduled timer can still reference its window's schedule.
+    if (m_Window != nullptr && m_ScheduleIndex != Unscheduled && m_ScheduleIndex != Firing)
+    {
+        m_Window->RemoveTimer(m_ScheduleIndex);
+    }
 }
 
 Timer& Timer::SetOnTimeout(OnEmptySignature&& Fn)
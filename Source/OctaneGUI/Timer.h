@@ -28,6 +28,8 @@ SOFTWARE.
 
 #include "CallbackDefs.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 
 namespace OctaneGUI
@@ -44,6 +46,8 @@ public:
     Timer& SetOnTimeout(OnEmptySignature&& Fn);
     void Invoke() const;
 
+    /// @brief Sets the number of milliseconds between timeouts. A running timer picks up
+    /// the new interval the next time it is started or repeats.
     Timer& SetInterval(int Interval);
     int Interval() const;
 
@@ -54,8 +58,15 @@ public:
     void Stop();
 
 private:
+    friend class Window;
+
+    // Position of this timer in the owning window's schedule.
+    static constexpr size_t Unscheduled = SIZE_MAX;
+    static constexpr size_t Firing = SIZE_MAX - 1;
+
     Timer();
 
+    size_t m_ScheduleIndex { Unscheduled };
     int m_Interval { 0 };
     bool m_Repeat { false };
     Window* m_Window { nullptr };
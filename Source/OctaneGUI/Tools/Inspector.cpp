@@ -499,7 +499,7 @@ void Inspector::OnToggled(Tree& Ref)
         const std::shared_ptr<Tree> Child = Ref.AddChild(Item->GetType());
         Child->SetMetaData(Item.get());
 
-        const std::shared_ptr<Container> ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Item->AsContainer();
         if (ItemContainer && ItemContainer->NumControls() > 0)
         {
             Child->AddChild("Pending");
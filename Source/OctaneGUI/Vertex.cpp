@@ -26,6 +26,9 @@ SOFTWARE.
 
 #include "Vertex.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace OctaneGUI
 {
 
@@ -57,4 +60,28 @@ Vertex::Vertex(const Vector2& InPosition, const Vector2& InTexCoords, const Colo
 {
 }
 
+static int16_t PackPosition(float Value)
+{
+    const float Fixed = std::round(Value / CompactVertex::PositionScale);
+    return (int16_t)std::clamp(Fixed, (float)INT16_MIN, (float)INT16_MAX);
+}
+
+static uint16_t PackUV(float Value)
+{
+    return (uint16_t)std::round(std::clamp(Value, 0.0f, 1.0f) * (float)UINT16_MAX);
+}
+
+CompactVertex::CompactVertex()
+{
+}
+
+CompactVertex::CompactVertex(const Vertex& Source)
+    : X(PackPosition(Source.Position.X))
+    , Y(PackPosition(Source.Position.Y))
+    , U(PackUV(Source.TexCoords.X))
+    , V(PackUV(Source.TexCoords.Y))
+    , Col(Source.Col)
+{
+}
+
 }
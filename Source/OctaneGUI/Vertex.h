@@ -29,6 +29,8 @@ SOFTWARE.
 #include "Color.h"
 #include "Vector2.h"
 
+#include <cstdint>
+
 namespace OctaneGUI
 {
 
@@ -45,4 +47,24 @@ public:
     Vertex(const Vector2& InPosition, const Vector2& InTexCoords, const Color& InCol);
 };
 
+/// @brief Packed vertex used by buffers with the compact layout.
+///
+/// Positions are stored in 16-bit fixed point with a quarter pixel of precision, which
+/// limits them to -8192 to 8191.75 pixels. Positions outside of that range are clamped.
+/// Texture coordinates are normalized to 16 bits.
+struct CompactVertex
+{
+public:
+    static constexpr float PositionScale = 0.25f;
+
+    int16_t X { 0 };
+    int16_t Y { 0 };
+    uint16_t U { 0 };
+    uint16_t V { 0 };
+    Color Col {};
+
+    CompactVertex();
+    CompactVertex(const Vertex& Source);
+};
+
 }
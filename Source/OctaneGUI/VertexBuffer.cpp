@@ -26,11 +26,35 @@ SOFTWARE.
 
 #include "VertexBuffer.h"
 
+#include <algorithm>
 #include <cstddef>
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    #define SIMD_SSE2 1
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #define SIMD_NEON 1
+    #include <arm_neon.h>
+#endif
+
 namespace OctaneGUI
 {
 
+// The quad kernels write a vertex's position and texture coordinates with a single 16-byte store.
+static_assert(sizeof(Rect) == sizeof(float) * 4, "Rect must be four packed floats.");
+static_assert(offsetof(Vertex, TexCoords) == offsetof(Vertex, Position) + sizeof(Vector2), "Vertex texture coordinates must follow the position.");
+
+// Number of vertices that 16-bit indices relative to a command's vertex offset can address.
+static constexpr uint32_t MaxCompactVertices = UINT16_MAX + 1;
+
+void VertexBuffer::Capture::Clear()
+{
+    Vertices.clear();
+    Indices.clear();
+    Primitives.clear();
+    Commands.clear();
+}
+
 VertexBuffer::VertexBuffer()
 {
 }
@@ -39,6 +63,53 @@ VertexBuffer::~VertexBuffer()
 {
 }
 
+void VertexBuffer::Clear()
+{
+    m_Statistics = GetStatistics();
+    m_VertexCapacity = m_Vertices.capacity();
+    m_IndexCapacity = m_Indices.capacity();
+    m_CommandCapacity = m_Commands.capacity();
+    m_PrimitiveCapacity = m_Primitives.capacity();
+    m_CompactVertexCapacity = m_CompactVertices.capacity();
+    m_CompactIndexCapacity = m_CompactIndices.capacity();
+
+    m_Vertices.clear();
+    m_Indices.clear();
+    m_Commands.clear();
+    m_Primitives.clear();
+    m_IndexBase = 0;
+    m_MergedCommands = 0;
+    m_Captures.clear();
+    m_PushRecords.clear();
+    m_Replays = 0;
+    m_CompactVertices.clear();
+    m_CompactIndices.clear();
+    m_Layout = VertexLayout::Standard();
+}
+
+VertexBuffer::Statistics VertexBuffer::GetStatistics() const
+{
+    Statistics Result = m_Statistics;
+    Result.MaxVertices = std::max<uint32_t>(Result.MaxVertices, (uint32_t)m_Vertices.size());
+    Result.MaxIndices = std::max<uint32_t>(Result.MaxIndices, (uint32_t)m_Indices.size());
+    Result.MaxCommands = std::max<uint32_t>(Result.MaxCommands, (uint32_t)m_Commands.size());
+    Result.MaxPrimitives = std::max<uint32_t>(Result.MaxPrimitives, (uint32_t)m_Primitives.size());
+    Result.MaxVertexBytes = std::max<uint32_t>(Result.MaxVertexBytes, (uint32_t)GetVertexDataSize());
+    Result.MaxIndexBytes = std::max<uint32_t>(Result.MaxIndexBytes, (uint32_t)GetIndexDataSize());
+
+    if (m_Vertices.capacity() != m_VertexCapacity
+        || m_Indices.capacity() != m_IndexCapacity
+        || m_Commands.capacity() != m_CommandCapacity
+        || m_Primitives.capacity() != m_PrimitiveCapacity
+        || m_CompactVertices.capacity() != m_CompactVertexCapacity
+        || m_CompactIndices.capacity() != m_CompactIndexCapacity)
+    {
+        Result.Growths++;
+    }
+
+    return Result;
+}
+
 void VertexBuffer::AddVertex(const Vector2& Point, const Color& Col)
 {
     m_Vertices.emplace_back(Point, Col);
@@ -63,7 +134,121 @@ void VertexBuffer::AddVertices(const std::vector<Vector2>& Points, const Color&
 
 void VertexBuffer::AddIndex(uint32_t Index)
 {
-    m_Indices.push_back(Index);
+    m_Indices.push_back(m_IndexBase + Index);
+}
+
+// Each quad is expanded into the corners Min, (Max.X, Min.Y), Max, (Min.X, Max.Y) and the
+// triangles (0, 1, 2) and (0, 2, 3).
+static void ExpandQuadVertices(const Rect* Rects, const Rect* UVs, const Color* Colors, size_t Count, Vertex* Vertices)
+{
+    size_t I = 0;
+
+#if defined(SIMD_SSE2)
+    // Selects the X and U lanes of a position and texture coordinate pair.
+    const __m128 Mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, 0, -1));
+    for (; I < Count; I++)
+    {
+        const __m128 R = _mm_loadu_ps(&Rects[I].Min.X);
+        const __m128 UV = _mm_loadu_ps(&UVs[I].Min.X);
+        const __m128 Min = _mm_movelh_ps(R, UV);
+        const __m128 Max = _mm_movehl_ps(UV, R);
+
+        Vertex* Quad = &Vertices[I * 4];
+        _mm_storeu_ps(&Quad[0].Position.X, Min);
+        _mm_storeu_ps(&Quad[1].Position.X, _mm_or_ps(_mm_and_ps(Mask, Max), _mm_andnot_ps(Mask, Min)));
+        _mm_storeu_ps(&Quad[2].Position.X, Max);
+        _mm_storeu_ps(&Quad[3].Position.X, _mm_or_ps(_mm_and_ps(Mask, Min), _mm_andnot_ps(Mask, Max)));
+        Quad[0].Col = Quad[1].Col = Quad[2].Col = Quad[3].Col = Colors[I];
+    }
+#elif defined(SIMD_NEON)
+    const uint32x4_t Mask = { UINT32_MAX, 0, UINT32_MAX, 0 };
+    for (; I < Count; I++)
+    {
+        const float32x4_t R = vld1q_f32(&Rects[I].Min.X);
+        const float32x4_t UV = vld1q_f32(&UVs[I].Min.X);
+        const float32x4_t Min = vcombine_f32(vget_low_f32(R), vget_low_f32(UV));
+        const float32x4_t Max = vcombine_f32(vget_high_f32(R), vget_high_f32(UV));
+
+        Vertex* Quad = &Vertices[I * 4];
+        vst1q_f32(&Quad[0].Position.X, Min);
+        vst1q_f32(&Quad[1].Position.X, vbslq_f32(Mask, Max, Min));
+        vst1q_f32(&Quad[2].Position.X, Max);
+        vst1q_f32(&Quad[3].Position.X, vbslq_f32(Mask, Min, Max));
+        Quad[0].Col = Quad[1].Col = Quad[2].Col = Quad[3].Col = Colors[I];
+    }
+#endif
+
+    for (; I < Count; I++)
+    {
+        const Rect& R = Rects[I];
+        const Rect& UV = UVs[I];
+
+        Vertex* Quad = &Vertices[I * 4];
+        Quad[0] = { R.Min, UV.Min, Colors[I] };
+        Quad[1] = { { R.Max.X, R.Min.Y }, { UV.Max.X, UV.Min.Y }, Colors[I] };
+        Quad[2] = { R.Max, UV.Max, Colors[I] };
+        Quad[3] = { { R.Min.X, R.Max.Y }, { UV.Min.X, UV.Max.Y }, Colors[I] };
+    }
+}
+
+static void ExpandQuadIndices(size_t Count, uint32_t Base, uint32_t* Indices)
+{
+    size_t I = 0;
+
+#if defined(SIMD_SSE2)
+    // Two quads per iteration.
+    const __m128i Pattern0 = _mm_setr_epi32(0, 1, 2, 0);
+    const __m128i Pattern1 = _mm_setr_epi32(2, 3, 4, 5);
+    const __m128i Pattern2 = _mm_setr_epi32(6, 4, 6, 7);
+    for (; I + 2 <= Count; I += 2)
+    {
+        const __m128i Offset = _mm_set1_epi32((int)(Base + I * 4));
+        __m128i* Target = (__m128i*)&Indices[I * 6];
+        _mm_storeu_si128(Target, _mm_add_epi32(Pattern0, Offset));
+        _mm_storeu_si128(Target + 1, _mm_add_epi32(Pattern1, Offset));
+        _mm_storeu_si128(Target + 2, _mm_add_epi32(Pattern2, Offset));
+    }
+#elif defined(SIMD_NEON)
+    const uint32x4_t Pattern0 = { 0, 1, 2, 0 };
+    const uint32x4_t Pattern1 = { 2, 3, 4, 5 };
+    const uint32x4_t Pattern2 = { 6, 4, 6, 7 };
+    for (; I + 2 <= Count; I += 2)
+    {
+        const uint32x4_t Offset = vdupq_n_u32((uint32_t)(Base + I * 4));
+        uint32_t* Target = &Indices[I * 6];
+        vst1q_u32(Target, vaddq_u32(Pattern0, Offset));
+        vst1q_u32(Target + 4, vaddq_u32(Pattern1, Offset));
+        vst1q_u32(Target + 8, vaddq_u32(Pattern2, Offset));
+    }
+#endif
+
+    for (; I < Count; I++)
+    {
+        const uint32_t Offset = Base + (uint32_t)I * 4;
+        uint32_t* Target = &Indices[I * 6];
+        Target[0] = Offset;
+        Target[1] = Offset + 1;
+        Target[2] = Offset + 2;
+        Target[3] = Offset;
+        Target[4] = Offset + 2;
+        Target[5] = Offset + 3;
+    }
+}
+
+void VertexBuffer::AddQuads(const Rect* Vertices, const Rect* TexCoords, const Color* Colors, size_t Count, uint32_t IndexOffset)
+{
+    if (Count == 0)
+    {
+        return;
+    }
+
+    const size_t VertexStart = m_Vertices.size();
+    const size_t IndexStart = m_Indices.size();
+    m_Vertices.resize(VertexStart + Count * 4);
+    m_Indices.resize(IndexStart + Count * 6);
+
+    ExpandQuadVertices(Vertices, TexCoords, Colors, Count, &m_Vertices[VertexStart]);
+    ExpandQuadIndices(Count, m_IndexBase + IndexOffset, &m_Indices[IndexStart]);
 }
 
 const std::vector<Vertex>& VertexBuffer::GetVertices() const
@@ -88,6 +273,39 @@ uint32_t VertexBuffer::GetIndexCount() const
 
 DrawCommand& VertexBuffer::PushCommand(uint32_t IndexCount, uint32_t TextureID, Rect Clip)
 {
+    if (!m_Commands.empty())
+    {
+        DrawCommand& Last = m_Commands.back();
+
+        // Only merge if the previous command has received all of its indices. Otherwise, the
+        // new indices would not be contiguous with the previous command's range.
+        // A command never references more vertices than it has indices, so IndexCount bounds
+        // the number of vertices this request will add.
+        if (!Last.IsPrimitive()
+            && Last.TextureID() == TextureID
+            && Last.Clip() == Clip
+            && Last.IndexOffset() + Last.IndexCount() == (uint32_t)m_Indices.size()
+            && (!m_Compact || (uint32_t)m_Vertices.size() - Last.VertexOffset() + IndexCount <= MaxCompactVertices))
+        {
+            m_IndexBase = (uint32_t)m_Vertices.size() - Last.VertexOffset();
+            m_MergedCommands++;
+
+            if (!m_Captures.empty())
+            {
+                m_PushRecords.push_back({ (uint32_t)m_Vertices.size(), (uint32_t)m_Indices.size(), (uint32_t)m_Primitives.size(), m_IndexBase, TextureID, Clip });
+            }
+
+            return Last.Extend(IndexCount);
+        }
+    }
+
+    m_IndexBase = 0;
+
+    if (!m_Captures.empty())
+    {
+        m_PushRecords.push_back({ (uint32_t)m_Vertices.size(), (uint32_t)m_Indices.size(), (uint32_t)m_Primitives.size(), m_IndexBase, TextureID, Clip });
+    }
+
     m_Commands.emplace_back((uint32_t)m_Vertices.size(), (uint32_t)m_Indices.size(), IndexCount, TextureID, Clip);
     return m_Commands.back();
 }
@@ -97,4 +315,188 @@ const std::vector<DrawCommand>& VertexBuffer::Commands() const
     return m_Commands;
 }
 
+void VertexBuffer::PushPrimitive(const Primitive& Instance, Rect Clip)
+{
+    if (!m_Captures.empty())
+    {
+        m_PushRecords.push_back({ (uint32_t)m_Vertices.size(), (uint32_t)m_Indices.size(), (uint32_t)m_Primitives.size(), 0, 0, Clip });
+    }
+
+    bool Merged = false;
+    if (!m_Commands.empty())
+    {
+        DrawCommand& Last = m_Commands.back();
+        if (Last.IsPrimitive()
+            && Last.Clip() == Clip
+            && Last.PrimitiveOffset() + Last.PrimitiveCount() == (uint32_t)m_Primitives.size())
+        {
+            Last.ExtendPrimitives(1);
+            m_MergedCommands++;
+            Merged = true;
+        }
+    }
+
+    if (!Merged)
+    {
+        m_Commands.push_back(DrawCommand::Primitives((uint32_t)m_Vertices.size(), (uint32_t)m_Indices.size(), (uint32_t)m_Primitives.size(), Clip).ExtendPrimitives(1));
+    }
+
+    m_Primitives.push_back(Instance);
+}
+
+const std::vector<Primitive>& VertexBuffer::GetPrimitives() const
+{
+    return m_Primitives;
+}
+
+uint32_t VertexBuffer::MergedCommands() const
+{
+    return m_MergedCommands;
+}
+
+void VertexBuffer::BeginCapture()
+{
+    m_Captures.push_back(m_PushRecords.size());
+}
+
+void VertexBuffer::EndCapture(Capture& Result)
+{
+    Result.Clear();
+
+    if (m_Captures.empty())
+    {
+        return;
+    }
+
+    const size_t Start = m_Captures.back();
+    m_Captures.pop_back();
+
+    for (size_t I = Start; I < m_PushRecords.size(); I++)
+    {
+        const PushRecord& Record = m_PushRecords[I];
+        const bool IsLast = I + 1 == m_PushRecords.size();
+        const uint32_t VertexEnd = IsLast ? (uint32_t)m_Vertices.size() : m_PushRecords[I + 1].VertexStart;
+        const uint32_t IndexEnd = IsLast ? (uint32_t)m_Indices.size() : m_PushRecords[I + 1].IndexStart;
+        const uint32_t PrimitiveEnd = IsLast ? (uint32_t)m_Primitives.size() : m_PushRecords[I + 1].PrimitiveStart;
+
+        Result.Commands.push_back({ VertexEnd - Record.VertexStart, IndexEnd - Record.IndexStart, PrimitiveEnd - Record.PrimitiveStart, Record.TextureID, Record.Clip });
+        Result.Vertices.insert(Result.Vertices.end(), m_Vertices.begin() + Record.VertexStart, m_Vertices.begin() + VertexEnd);
+        Result.Primitives.insert(Result.Primitives.end(), m_Primitives.begin() + Record.PrimitiveStart, m_Primitives.begin() + PrimitiveEnd);
+
+        for (uint32_t Index = Record.IndexStart; Index < IndexEnd; Index++)
+        {
+            Result.Indices.push_back(m_Indices[Index] - Record.IndexBase);
+        }
+    }
+
+    // Records are only needed while a capture is active. An outer capture still needs them.
+    if (m_Captures.empty())
+    {
+        m_PushRecords.clear();
+    }
+}
+
+void VertexBuffer::Replay(const Capture& Source)
+{
+    size_t VertexStart = 0;
+    size_t IndexStart = 0;
+    size_t PrimitiveStart = 0;
+    for (const Capture::Command& Command : Source.Commands)
+    {
+        if (Command.PrimitiveCount > 0)
+        {
+            for (size_t I = PrimitiveStart; I < PrimitiveStart + Command.PrimitiveCount; I++)
+            {
+                PushPrimitive(Source.Primitives[I], Command.Clip);
+            }
+
+            PrimitiveStart += Command.PrimitiveCount;
+            continue;
+        }
+
+        PushCommand(Command.IndexCount, Command.TextureID, Command.Clip);
+
+        m_Vertices.insert(m_Vertices.end(), Source.Vertices.begin() + VertexStart, Source.Vertices.begin() + VertexStart + Command.VertexCount);
+
+        m_Indices.reserve(m_Indices.size() + Command.IndexCount);
+        for (size_t I = IndexStart; I < IndexStart + Command.IndexCount; I++)
+        {
+            AddIndex(Source.Indices[I]);
+        }
+
+        VertexStart += Command.VertexCount;
+        IndexStart += Command.IndexCount;
+    }
+
+    m_Replays++;
+}
+
+uint32_t VertexBuffer::Replays() const
+{
+    return m_Replays;
+}
+
+VertexBuffer& VertexBuffer::SetCompact(bool Compact)
+{
+    m_Compact = Compact;
+    return *this;
+}
+
+bool VertexBuffer::IsCompact() const
+{
+    return m_Compact;
+}
+
+void VertexBuffer::Pack()
+{
+    m_CompactVertices.clear();
+    m_CompactIndices.clear();
+    m_Layout = VertexLayout::Standard();
+
+    if (!m_Compact)
+    {
+        return;
+    }
+
+    m_Layout = VertexLayout::Compact();
+    m_CompactVertices.assign(m_Vertices.begin(), m_Vertices.end());
+
+    for (size_t I = 0; I < m_Commands.size(); I++)
+    {
+        const uint32_t VertexEnd = I + 1 < m_Commands.size() ? m_Commands[I + 1].VertexOffset() : (uint32_t)m_Vertices.size();
+        if (VertexEnd - m_Commands[I].VertexOffset() > MaxCompactVertices)
+        {
+            m_Layout.IndexSize = sizeof(uint32_t);
+            return;
+        }
+    }
+
+    m_CompactIndices.assign(m_Indices.begin(), m_Indices.end());
+}
+
+const VertexLayout& VertexBuffer::GetLayout() const
+{
+    return m_Layout;
+}
+
+const void* VertexBuffer::GetVertexData() const
+{
+    return m_CompactVertices.empty() ? (const void*)m_Vertices.data() : (const void*)m_CompactVertices.data();
+}
+
+size_t VertexBuffer::GetVertexDataSize() const
+{
+    return m_Vertices.size() * m_Layout.Stride;
+}
+
+const void* VertexBuffer::GetIndexData() const
+{
+    return m_CompactIndices.empty() ? (const void*)m_Indices.data() : (const void*)m_CompactIndices.data();
+}
+
+size_t VertexBuffer::GetIndexDataSize() const
+{
+    return m_Indices.size() * m_Layout.IndexSize;
+}
+
 }
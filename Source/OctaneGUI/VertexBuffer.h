@@ -27,7 +27,9 @@ SOFTWARE.
 #pragma once
 
 #include "DrawCommand.h"
+#include "Primitive.h"
 #include "Vertex.h"
+#include "VertexLayout.h"
 
 #include <vector>
 
@@ -37,27 +39,167 @@ namespace OctaneGUI
 class VertexBuffer
 {
 public:
+    /// @brief Geometry recorded between BeginCapture and EndCapture that can be replayed
+    /// into a buffer at a later time.
+    struct Capture
+    {
+    public:
+        struct Command
+        {
+        public:
+            uint32_t VertexCount { 0 };
+            uint32_t IndexCount { 0 };
+            uint32_t PrimitiveCount { 0 };
+            uint32_t TextureID { 0 };
+            Rect Clip {};
+        };
+
+        void Clear();
+
+        std::vector<Vertex> Vertices {};
+        // Indices are relative to the first vertex of the command they belong to.
+        std::vector<uint32_t> Indices {};
+        std::vector<Primitive> Primitives {};
+        std::vector<Command> Commands {};
+    };
+
+    /// @brief Peak sizes reached by a buffer and how often its storage had to grow.
+    ///
+    /// The vertex and index counts are the same for both layouts. The byte sizes are of the
+    /// data returned by GetVertexData and GetIndexData, in whichever layout Pack produced.
+    struct Statistics
+    {
+    public:
+        uint32_t MaxVertices { 0 };
+        uint32_t MaxIndices { 0 };
+        uint32_t MaxCommands { 0 };
+        uint32_t MaxPrimitives { 0 };
+        uint32_t MaxVertexBytes { 0 };
+        uint32_t MaxIndexBytes { 0 };
+        uint32_t Growths { 0 };
+    };
+
     VertexBuffer();
     ~VertexBuffer();
 
+    /// @brief Removes all geometry while keeping the allocated storage for reuse.
+    ///
+    /// The high-water marks are updated before clearing.
+    void Clear();
+
+    /// @brief Statistics including the current contents. Growths counts the frames, delimited
+    /// by Clear, during which any storage had to be reallocated.
+    Statistics GetStatistics() const;
+
     void AddVertex(const Vector2& Point, const Color& Col);
     void AddVertex(const Vector2& Point, const Vector2& TexCoords, const Color& Col);
     void AddVertices(const std::vector<Vector2>& Points, const Color& Tint);
     void AddIndex(uint32_t Index);
 
+    /// @brief Adds two triangles for each rect with a single resize of the vertex and index
+    /// storage. Uses SSE2 or NEON when the target supports them.
+    ///
+    /// @param Vertices The bounds of each quad.
+    /// @param TexCoords The texture coordinates of each quad.
+    /// @param Colors The color of each quad.
+    /// @param Count The number of quads.
+    /// @param IndexOffset Index of the first quad's vertices relative to the current command.
+    void AddQuads(const Rect* Vertices, const Rect* TexCoords, const Color* Colors, size_t Count, uint32_t IndexOffset = 0);
+
     const std::vector<Vertex>& GetVertices() const;
     const std::vector<uint32_t>& GetIndices() const;
 
     uint32_t GetVertexCount() const;
     uint32_t GetIndexCount() const;
 
+    /// @brief Begins a new draw command or continues the previous one.
+    ///
+    /// If the previous command uses the same texture and clip rect, the new indices
+    /// are appended to it instead of creating a new command. Any indices added after
+    /// this call are rebased to be relative to the merged command's vertex offset.
+    ///
+    /// @param IndexCount Number of indices that will be added for this command.
+    /// @param TextureID The texture to bind for this command. 0 is the default texture.
+    /// @param Clip The clip rect for this command. A zero rect means no clipping.
+    /// @return The command the indices will be added to.
     DrawCommand& PushCommand(uint32_t IndexCount, uint32_t TextureID, Rect Clip);
     const std::vector<DrawCommand>& Commands() const;
 
+    /// @brief Records a primitive instance. Consecutive primitives with the same clip rect
+    /// are drawn by a single command.
+    void PushPrimitive(const Primitive& Instance, Rect Clip);
+    const std::vector<Primitive>& GetPrimitives() const;
+
+    /// @brief Number of PushCommand requests that were merged into a previous command.
+    uint32_t MergedCommands() const;
+
+    void BeginCapture();
+    void EndCapture(Capture& Result);
+    void Replay(const Capture& Source);
+
+    /// @brief Number of captures that were replayed into this buffer.
+    uint32_t Replays() const;
+
+    /// @brief Sets whether Pack converts the geometry into the compact layout.
+    ///
+    /// Commands are not merged past 65536 vertices while compact so that their indices
+    /// fit in 16 bits. Compact positions are clamped to -8192 to 8191.75 pixels, so this
+    /// should not be enabled for windows larger than that.
+    ///
+    /// @param Compact Boolean to enable the compact layout.
+    /// @return This reference for chaining.
+    VertexBuffer& SetCompact(bool Compact);
+    bool IsCompact() const;
+
+    /// @brief Prepares the data returned by GetVertexData and GetIndexData. This should
+    /// be called once all geometry for the frame has been added.
+    void Pack();
+
+    /// @brief Layout of the data returned by GetVertexData and GetIndexData. If any
+    /// command references more vertices than 16-bit indices can address, 32-bit indices
+    /// are used for the frame.
+    const VertexLayout& GetLayout() const;
+    const void* GetVertexData() const;
+    size_t GetVertexDataSize() const;
+    const void* GetIndexData() const;
+    size_t GetIndexDataSize() const;
+
 private:
+    struct PushRecord
+    {
+    public:
+        uint32_t VertexStart { 0 };
+        uint32_t IndexStart { 0 };
+        uint32_t PrimitiveStart { 0 };
+        uint32_t IndexBase { 0 };
+        uint32_t TextureID { 0 };
+        Rect Clip {};
+    };
+
     std::vector<Vertex> m_Vertices;
     std::vector<uint32_t> m_Indices;
     std::vector<DrawCommand> m_Commands;
+    std::vector<Primitive> m_Primitives {};
+    uint32_t m_IndexBase { 0 };
+    uint32_t m_MergedCommands { 0 };
+
+    // Start of each active capture within m_PushRecords. Captures may be nested.
+    std::vector<size_t> m_Captures {};
+    std::vector<PushRecord> m_PushRecords {};
+    uint32_t m_Replays { 0 };
+
+    bool m_Compact { false };
+    VertexLayout m_Layout { VertexLayout::Standard() };
+    std::vector<CompactVertex> m_CompactVertices {};
+    std::vector<uint16_t> m_CompactIndices {};
+
+    Statistics m_Statistics {};
+    size_t m_VertexCapacity { 0 };
+    size_t m_IndexCapacity { 0 };
+    size_t m_CommandCapacity { 0 };
+    size_t m_PrimitiveCapacity { 0 };
+    size_t m_CompactVertexCapacity { 0 };
+    size_t m_CompactIndexCapacity { 0 };
 };
 
 }
@@ -0,0 +1,59 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "VertexLayout.h"
+#include "Vertex.h"
+
+#include <cstddef>
+
+namespace OctaneGUI
+{
+
+VertexLayout VertexLayout::Standard()
+{
+    VertexLayout Result;
+    Result.Position = { Format::Float2, (uint32_t)offsetof(Vertex, Position) };
+    Result.TexCoords = { Format::Float2, (uint32_t)offsetof(Vertex, TexCoords) };
+    Result.Col = { Format::UByte4Norm, (uint32_t)offsetof(Vertex, Col) };
+    Result.Stride = sizeof(Vertex);
+    Result.IndexSize = sizeof(uint32_t);
+    Result.PositionScale = 1.0f;
+    return Result;
+}
+
+VertexLayout VertexLayout::Compact()
+{
+    VertexLayout Result;
+    Result.Position = { Format::Short2, (uint32_t)offsetof(CompactVertex, X) };
+    Result.TexCoords = { Format::UShort2Norm, (uint32_t)offsetof(CompactVertex, U) };
+    Result.Col = { Format::UByte4Norm, (uint32_t)offsetof(CompactVertex, Col) };
+    Result.Stride = sizeof(CompactVertex);
+    Result.IndexSize = sizeof(uint16_t);
+    Result.PositionScale = CompactVertex::PositionScale;
+    return Result;
+}
+
+}
@@ -0,0 +1,70 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace OctaneGUI
+{
+
+/// @brief Describes how the vertex and index data of a VertexBuffer is laid out so
+/// that a frontend can set up its vertex attributes.
+struct VertexLayout
+{
+public:
+    enum class Format : uint8_t
+    {
+        Float2,
+        Short2,
+        UShort2Norm,
+        UByte4Norm,
+    };
+
+    struct Attribute
+    {
+    public:
+        Format Type { Format::Float2 };
+        uint32_t Offset { 0 };
+    };
+
+    /// @brief Layout of the Vertex structure with 32-bit indices.
+    static VertexLayout Standard();
+
+    /// @brief Layout of the CompactVertex structure with 16-bit indices.
+    static VertexLayout Compact();
+
+    Attribute Position {};
+    Attribute TexCoords {};
+    Attribute Col {};
+    uint32_t Stride { 0 };
+    uint32_t IndexSize { sizeof(uint32_t) };
+
+    /// Positions must be multiplied by this value to get the position in pixels.
+    float PositionScale { 1.0f };
+};
+
+}
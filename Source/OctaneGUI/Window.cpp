@@ -47,17 +47,42 @@ SOFTWARE.
 namespace OctaneGUI
 {
 
+// Controls are placed by their closest container, so that is what needs to be laid out.
+static std::shared_ptr<Container> ClosestContainer(Control* Item)
+{
+    for (; Item != nullptr; Item = Item->GetParent())
+    {
+        if (Item->IsContainer())
+        {
+            return std::static_pointer_cast<Container>(Item->Share());
+        }
+    }
+
+    return nullptr;
+}
+
+// The area to repaint for a control that moved or resized from Previous to Current.
+static Rect ChangedBounds(const Rect& Previous, const Rect& Current)
+{
+    if (Previous.Width() <= 0.0f || Previous.Height() <= 0.0f)
+    {
+        return Current;
+    }
+
+    if (Current.Width() <= 0.0f || Current.Height() <= 0.0f)
+    {
+        return Previous;
+    }
+
+    return Previous.Union(Current);
+}
+
 Window::Window(Application* InApplication)
     : m_Application(InApplication)
 {
     m_Popup.SetOnInvalidate([=](std::shared_ptr<Control> Focus, InvalidateType Type) -> void
         {
-            if ((Type == InvalidateType::Layout || Type == InvalidateType::Both))
-            {
-                RequestLayout(std::dynamic_pointer_cast<Container>(Focus));
-            }
-
-            m_Repaint = true;
+            OnInvalidate(Focus, Type);
         });
 
     m_Popup.SetOnClose([=](const Container& Focus) -> void
@@ -69,14 +94,27 @@ Window::Window(Application* InApplication)
             }
 
             m_Container->CloseMenuBar();
-            m_Repaint = true;
+            Repaint();
         });
 }
 
 Window::~Window()
 {
-    m_Container->SetWindow(nullptr);
-    m_Container = nullptr;
+    if (m_Container)
+    {
+        m_Container->SetWindow(nullptr);
+        m_Container = nullptr;
+    }
+
+    // Detach every timer created by this window, scheduled or not, since they may outlive it.
+    for (const std::weak_ptr<Timer>& Created : m_CreatedTimers)
+    {
+        if (std::shared_ptr<Timer> Object = Created.lock())
+        {
+            Object->m_ScheduleIndex = Timer::Unscheduled;
+            Object->m_Window = nullptr;
+        }
+    }
 }
 
 Window& Window::SetTitle(const char* Title)
@@ -88,6 +126,12 @@ Window& Window::SetTitle(const char32_t* Title)
 {
     m_Title = Title;
 
+#if TOOLS
+    const std::string Name = String::ToMultiByte(Title);
+    m_UpdateLabel = "Window::Update (" + Name + ")";
+    m_PaintLabel = "Window::OnPaint (" + Name + ")";
+#endif
+
     if (m_OnSetTitle)
     {
         m_OnSetTitle(*this, Title);
@@ -178,6 +222,7 @@ Vector2 Window::DeviceSize() const
 Window& Window::SetRenderScale(Vector2 RenderScale)
 {
     m_RenderScale = RenderScale;
+    m_PaintGeneration++;
     m_Container->SetSize(m_Bounds.GetSize() * m_RenderScale);
     return *this;
 }
@@ -224,6 +269,7 @@ Window& Window::SetVisible(bool Visible)
 {
     m_Visible = Visible;
     m_Repaint = Visible;
+    m_RepaintAll = Visible;
     if (m_Visible)
     {
         SetCustomTitleBar(CustomTitleBar());
@@ -641,7 +687,19 @@ void Window::OnText(uint32_t Code)
 
 void Window::ThemeLoaded()
 {
+    m_PaintGeneration++;
     m_Container->OnThemeLoaded();
+
+    // Any measurement may depend on a theme property, so the whole tree is laid out again.
+    m_Container->InvalidateAllLayouts();
+    RequestLayout(m_Container);
+
+    const std::shared_ptr<Container>& Popup = m_Popup.GetContainer();
+    if (Popup)
+    {
+        Popup->InvalidateAllLayouts();
+        RequestLayout(Popup);
+    }
 }
 
 void Window::CreateContainer()
@@ -650,15 +708,10 @@ void Window::CreateContainer()
     m_Container
         ->SetOnInvalidate([=](std::shared_ptr<Control> Focus, InvalidateType Type) -> void
             {
-                if ((Type == InvalidateType::Layout || Type == InvalidateType::Both))
-                {
-                    RequestLayout(std::dynamic_pointer_cast<Container>(Focus));
-                }
-
-                m_Repaint = true;
+                OnInvalidate(Focus, Type);
             });
 
-    m_Repaint = true;
+    Repaint();
 }
 
 std::shared_ptr<Container> Window::GetContainer() const
@@ -724,24 +777,77 @@ Window& Window::SetMousePosition(const Vector2& Position)
     return *this;
 }
 
-void Window::Update()
+void Window::Update(float Budget)
 {
-    PROFILER_SAMPLE_GROUP((std::string("Window::Update (") + String::ToMultiByte(GetTitle()) + ")").c_str());
+    PROFILER_SAMPLE_GROUP(m_UpdateLabel.c_str());
 
     UpdateTimers();
 
     if (!m_LayoutRequests.empty())
     {
-        const std::vector<std::weak_ptr<Container>> Requests = m_LayoutRequests;
-        m_LayoutRequests.clear();
-        for (const std::weak_ptr<Container>& Item : Requests)
+        m_Scratch.Reset();
+
+        // Requests made while processing belong to the next generation.
+        m_PendingLayouts.swap(m_LayoutRequests);
+        const uint32_t Generation = m_LayoutGeneration++;
+
+        const Clock Elapsed;
+        size_t Processed = 0;
+        for (size_t I = 0; I < m_PendingLayouts.size(); I++)
         {
-            if (!Item.expired())
+            const std::weak_ptr<Container>& Item = m_PendingLayouts[I];
+            if (Item.expired())
+            {
+                continue;
+            }
+
+            const std::shared_ptr<Container> Request = Item.lock();
+
+            // A parent with a pending request will lay out this container as well.
+            if (IsLayoutRequested(Request->GetParent(), Generation))
             {
-                Item.lock()->Layout();
+                continue;
+            }
+
+            // Requests that do not fit within the budget are kept for the next update. At least
+            // one request is processed so that layout always makes progress.
+            if (Budget >= 0.0f && Processed > 0 && Elapsed.Measure() * 1000.0f >= Budget)
+            {
+                RequestLayout(Request);
+                continue;
+            }
+
+            // A container that wants a new size has to be placed again by its parent, which
+            // will lay out this container as well. Otherwise only this subtree is laid out.
+            if (Request->DesiredSizeChanged())
+            {
+                // Popups and other owned containers are not placed by their parent.
+                Container* Parent = Request->GetParent() != nullptr ? Request->GetParent()->AsContainer() : nullptr;
+                if (Parent != nullptr && Parent->HasControl(Request))
+                {
+                    if (Parent->LayoutRequest() != Generation)
+                    {
+                        Parent->SetLayoutRequest(Generation);
+                        m_PendingLayouts.push_back(std::static_pointer_cast<Container>(Parent->Share()));
+                    }
+
+                    continue;
+                }
             }
+
+            // The container may have moved or resized its contents.
+            const Rect Previous = Request->GetAbsoluteBounds();
+            Request->Layout();
+            AddDamage(ChangedBounds(Previous, Request->GetAbsoluteBounds()));
+            Processed++;
         }
 
+        m_PendingLayouts.clear();
+
+        // Rebuild the hit-testing grids of containers that moved now, so that the next mouse
+        // event does not pay for it.
+        m_Container->UpdateHitIndex();
+
         if (m_OnLayout)
         {
             m_OnLayout(*this);
@@ -751,22 +857,217 @@ void Window::Update()
     m_Popup.Update();
 }
 
-void Window::DoPaint(Paint& Brush)
+bool Window::NeedsUpdate() const
+{
+    return m_Repaint || !m_LayoutRequests.empty();
+}
+
+ScratchArena& Window::Scratch()
+{
+    return m_Scratch;
+}
+
+void Window::TrackInput(int64_t Timestamp)
+{
+    if (m_UnpaintedInput == 0 || Timestamp < m_UnpaintedInput)
+    {
+        m_UnpaintedInput = Timestamp;
+    }
+}
+
+int64_t Window::OldestUnpaintedInput() const
+{
+    return m_UnpaintedInput;
+}
+
+void Window::ClearUnpaintedInput()
+{
+    m_UnpaintedInput = 0;
+}
+
+void Window::DoPaint()
+{
+    BuildPaint();
+    SubmitPaint();
+}
+
+bool Window::BuildPaint()
 {
     if (m_Repaint)
     {
-        PROFILER_SAMPLE_GROUP((std::string("Window::OnPaint (") + String::ToMultiByte(GetTitle()) + ")").c_str());
+        PROFILER_SAMPLE_GROUP(m_PaintLabel.c_str());
+
+        if (!m_Brush)
+        {
+            m_Brush = std::make_unique<Paint>(GetTheme());
+        }
+        else
+        {
+            m_Brush->Clear();
+        }
 
-        m_Container->OnPaint(Brush);
-        m_Popup.OnPaint(Brush);
+        m_Brush->SetCompact(m_CompactVertices);
+        m_Brush->SetUsePrimitives(m_PrimitiveRendering);
+
+        if (m_RepaintAll || m_Damage.empty())
+        {
+            m_Damage.assign(1, { Vector2::Zero, m_Container->GetSize() });
+        }
+
+        if (m_PartialRepaint)
+        {
+            m_Brush->SetDamage(m_Damage);
+        }
+
+        m_Container->OnPaint(*m_Brush);
+        m_Popup.OnPaint(*m_Brush);
+        m_Brush->Pack();
         m_Repaint = false;
-        m_OnPaint(this, Brush.GetBuffer());
+        m_RepaintAll = false;
+        m_PaintBuilt = true;
+        return true;
+    }
+
+    return false;
+}
+
+void Window::SubmitPaint()
+{
+    if (!m_PaintBuilt)
+    {
+        return;
+    }
+
+    m_PaintBuilt = false;
+    m_OnPaint(this, m_Brush->GetBuffer(), m_Damage);
+    m_Damage.clear();
+}
+
+bool Window::NeedsRepaint() const
+{
+    return m_Repaint;
+}
+
+VertexBuffer::Statistics Window::PaintStatistics() const
+{
+    if (!m_Brush)
+    {
+        return {};
     }
+
+    return m_Brush->GetBuffer().GetStatistics();
+}
+
+Window& Window::SetCompactVertices(bool CompactVertices)
+{
+    if (m_CompactVertices != CompactVertices)
+    {
+        m_CompactVertices = CompactVertices;
+        Repaint();
+    }
+
+    return *this;
+}
+
+bool Window::CompactVertices() const
+{
+    return m_CompactVertices;
+}
+
+Window& Window::SetPrimitiveRendering(bool PrimitiveRendering)
+{
+    if (m_PrimitiveRendering != PrimitiveRendering)
+    {
+        // Cached control geometry was recorded for the previous mode.
+        m_PrimitiveRendering = PrimitiveRendering;
+        m_PaintGeneration++;
+        Repaint();
+    }
+
+    return *this;
+}
+
+bool Window::PrimitiveRendering() const
+{
+    return m_PrimitiveRendering;
 }
 
 void Window::Repaint()
 {
     m_Repaint = true;
+    m_RepaintAll = true;
+}
+
+Window& Window::AddDamage(const Rect& Bounds)
+{
+    m_Repaint = true;
+
+    if (m_RepaintAll)
+    {
+        return *this;
+    }
+
+    Rect Damage = Bounds.Intersection({ Vector2::Zero, m_Container->GetSize() });
+    if (Damage.Width() <= 0.0f || Damage.Height() <= 0.0f)
+    {
+        return *this;
+    }
+
+    // Merge with any overlapping regions. A merged region may now overlap regions
+    // that were previously checked, so continue until no more merges occur.
+    bool Merged = true;
+    while (Merged)
+    {
+        Merged = false;
+        for (std::vector<Rect>::iterator It = m_Damage.begin(); It != m_Damage.end(); ++It)
+        {
+            if (It->Encompasses(Damage))
+            {
+                return *this;
+            }
+
+            if (It->Intersects(Damage) || Damage.Encompasses(*It))
+            {
+                Damage = Damage.Union(*It);
+                m_Damage.erase(It);
+                Merged = true;
+                break;
+            }
+        }
+    }
+
+    m_Damage.push_back(Damage);
+
+    // Too many disjoint regions costs more than painting their bounding area.
+    const size_t MaxRegions = 8;
+    if (m_Damage.size() > MaxRegions)
+    {
+        Rect Bounding = m_Damage.front();
+        for (const Rect& Item : m_Damage)
+        {
+            Bounding = Bounding.Union(Item);
+        }
+
+        m_Damage.assign(1, Bounding);
+    }
+
+    return *this;
+}
+
+Window& Window::SetPartialRepaint(bool PartialRepaint)
+{
+    m_PartialRepaint = PartialRepaint;
+    return *this;
+}
+
+bool Window::PartialRepaint() const
+{
+    return m_PartialRepaint;
+}
+
+uint32_t Window::PaintGeneration() const
+{
+    return m_PaintGeneration;
 }
 
 void Window::Load(const char* JsonStream)
@@ -807,6 +1108,7 @@ void Window::LoadRoot(const Json& Root)
     SetCanMinimize(Root["CanMinimize"].Boolean(CanMinimize()));
     SetCustomTitleBar(Root["CustomTitleBar"].Boolean(CustomTitleBar()));
     SetMaximized(Root["Maximized"].Boolean(IsMaximized()));
+    SetCompactVertices(Root["CompactVertices"].Boolean(CompactVertices()));
 
     if (Root["Modal"].Boolean(Modal()))
     {
@@ -830,56 +1132,65 @@ void Window::Clear()
     m_Container->Clear();
     m_Popup.Close();
     m_LayoutRequests.clear();
+
+    // Containers still marked with the current generation no longer have a request.
+    m_LayoutGeneration++;
 }
 
 std::shared_ptr<Timer> Window::CreateTimer(int Interval, bool Repeat, OnEmptySignature&& Callback)
 {
     std::shared_ptr Result = std::make_unique<Timer>(Interval, Repeat, this, std::move(Callback));
+
+    // Drop timers that no longer exist before the list needs to grow.
+    if (m_CreatedTimers.size() == m_CreatedTimers.capacity())
+    {
+        m_CreatedTimers.erase(std::remove_if(m_CreatedTimers.begin(), m_CreatedTimers.end(), [](const std::weak_ptr<Timer>& Created) -> bool
+            {
+                return Created.expired();
+            }),
+            m_CreatedTimers.end());
+    }
+
+    m_CreatedTimers.push_back(Result);
     return Result;
 }
 
 void Window::StartTimer(const std::shared_ptr<Timer>& Object)
 {
-    for (std::vector<TimerHandle>::iterator It = m_Timers.begin(); It != m_Timers.end();)
+    if (Object->m_ScheduleIndex < m_Timers.size())
     {
-        TimerHandle& Handle = *It;
-
-        if (Handle.Object.expired())
-        {
-            It = m_Timers.erase(It);
-        }
-        else if (Handle.Object.lock() == Object)
-        {
-            Handle.Elapsed.Reset();
-            return;
-        }
-        else
-        {
-            It++;
-        }
+        RemoveTimer(Object->m_ScheduleIndex);
     }
 
-    m_Timers.emplace_back(Object);
+    ScheduleTimer(Object.get(), m_TimerClock.MeasureMS() + Object->Interval());
 }
 
 bool Window::ClearTimer(const std::shared_ptr<Timer>& Object)
 {
-    for (std::vector<TimerHandle>::const_iterator It = m_Timers.begin(); It != m_Timers.end();)
+    if (Object->m_ScheduleIndex == Timer::Firing)
     {
-        const TimerHandle& Handle = *It;
+        Object->m_ScheduleIndex = Timer::Unscheduled;
+        return true;
+    }
 
-        if (Handle.Object.expired() || Handle.Object.lock() == Object)
-        {
-            m_Timers.erase(It);
-            return true;
-        }
-        else
-        {
-            ++It;
-        }
+    if (Object->m_ScheduleIndex >= m_Timers.size())
+    {
+        return false;
     }
 
-    return false;
+    RemoveTimer(Object->m_ScheduleIndex);
+    return true;
+}
+
+int Window::NextTimerDeadline() const
+{
+    if (m_Timers.empty())
+    {
+        return -1;
+    }
+
+    const int64_t Remaining = std::max<int64_t>(m_Timers.front().Deadline - m_TimerClock.MeasureMS(), 0);
+    return (int)std::min<int64_t>(Remaining, INT32_MAX);
 }
 
 Window& Window::SetOnPaint(OnPaintSignature&& Fn)
@@ -945,6 +1256,24 @@ void Window::Populate(ControlList& List) const
     m_Container->GetControlList(List);
 }
 
+void Window::OnInvalidate(const std::shared_ptr<Control>& Focus, InvalidateType Type)
+{
+    if ((Type == InvalidateType::Layout || Type == InvalidateType::Both))
+    {
+        RequestLayout(ClosestContainer(Focus.get()));
+    }
+
+    if (Focus)
+    {
+        // Also repaint the area the control covered before it moved or shrank.
+        AddDamage(ChangedBounds(Focus->PaintedBounds(), Focus->GetAbsoluteBounds()));
+    }
+    else
+    {
+        Repaint();
+    }
+}
+
 void Window::RequestLayout(std::shared_ptr<Container> Request)
 {
     if (!Request)
@@ -952,58 +1281,162 @@ void Window::RequestLayout(std::shared_ptr<Container> Request)
         return;
     }
 
-    bool Found = false;
-    for (const std::weak_ptr<Container>& Item : m_LayoutRequests)
+    // The request is already covered if the container or one of its parents is pending.
+    if (IsLayoutRequested(Request.get(), m_LayoutGeneration))
     {
-        if (!Item.expired())
-        {
-            const std::shared_ptr<Container> ItemContainer = Item.lock();
-            if (ItemContainer == Request || ItemContainer->HasControlRecurse(Request))
-            {
-                Found = true;
-                break;
-            }
-        }
+        return;
     }
 
-    if (!Found)
+    Request->SetLayoutRequest(m_LayoutGeneration);
+    m_LayoutRequests.push_back(Request);
+}
+
+bool Window::IsLayoutRequested(const Control* Item, uint32_t Generation) const
+{
+    for (const Control* Parent = Item; Parent != nullptr; Parent = Parent->GetParent())
     {
-        m_LayoutRequests.push_back(Request);
+        const Container* ParentContainer = Parent->AsContainer();
+        if (ParentContainer != nullptr && ParentContainer->LayoutRequest() == Generation)
+        {
+            return true;
+        }
     }
+
+    return false;
 }
 
 void Window::UpdateTimers()
 {
-    for (std::vector<TimerHandle>::iterator It = m_Timers.begin(); It != m_Timers.end();)
+    if (m_Timers.empty())
     {
-        TimerHandle& Handle = *It;
+        return;
+    }
 
-        if (Handle.Object.expired())
+    // Collect every due timer before invoking any callbacks so that timers started by a
+    // callback are not fired until the next update.
+    const int64_t Now = m_TimerClock.MeasureMS();
+    while (!m_Timers.empty() && m_Timers.front().Deadline <= Now)
+    {
+        Timer* Target = m_Timers.front().Target;
+        RemoveTimer(0);
+        Target->m_ScheduleIndex = Timer::Firing;
+        m_DueTimers.push_back(Target->weak_from_this());
+    }
+
+    for (const std::weak_ptr<Timer>& Due : m_DueTimers)
+    {
+        std::shared_ptr<Timer> Object = Due.lock();
+
+        // Skip timers that were destroyed, stopped, or restarted by an earlier callback.
+        if (!Object || Object->m_ScheduleIndex != Timer::Firing)
         {
-            It = m_Timers.erase(It);
             continue;
         }
 
-        std::shared_ptr<Timer> Object = Handle.Object.lock();
-        if (Handle.Elapsed.MeasureMS() >= Object->Interval())
+        Object->Invoke();
+
+        if (Object->m_ScheduleIndex == Timer::Firing)
         {
-            Object->Invoke();
+            Object->m_ScheduleIndex = Timer::Unscheduled;
 
             if (Object->Repeat())
             {
-                Handle.Elapsed.Reset();
-                It++;
-            }
-            else
-            {
-                It = m_Timers.erase(It);
+                ScheduleTimer(Object.get(), Now + Object->Interval());
             }
         }
-        else
+    }
+
+    m_DueTimers.clear();
+}
+
+void Window::ScheduleTimer(Timer* Object, int64_t Deadline)
+{
+    TimerHandle Handle;
+    Handle.Target = Object;
+    Handle.Deadline = Deadline;
+    Handle.Sequence = m_TimerSequence++;
+
+    m_Timers.emplace_back();
+    PlaceTimer(m_Timers.size() - 1, Handle);
+    SiftTimerUp(m_Timers.size() - 1);
+}
+
+void Window::RemoveTimer(size_t Index)
+{
+    m_Timers[Index].Target->m_ScheduleIndex = Timer::Unscheduled;
+
+    const size_t Last = m_Timers.size() - 1;
+    if (Index != Last)
+    {
+        PlaceTimer(Index, m_Timers[Last]);
+    }
+
+    m_Timers.pop_back();
+
+    if (Index < m_Timers.size())
+    {
+        SiftTimerUp(Index);
+        SiftTimerDown(Index);
+    }
+}
+
+static bool IsTimerBefore(int64_t Deadline, uint64_t Sequence, int64_t OtherDeadline, uint64_t OtherSequence)
+{
+    return Deadline < OtherDeadline || (Deadline == OtherDeadline && Sequence < OtherSequence);
+}
+
+void Window::SiftTimerUp(size_t Index)
+{
+    const TimerHandle Handle = m_Timers[Index];
+    while (Index > 0)
+    {
+        const size_t Parent = (Index - 1) / 2;
+        const TimerHandle& Other = m_Timers[Parent];
+        if (!IsTimerBefore(Handle.Deadline, Handle.Sequence, Other.Deadline, Other.Sequence))
         {
-            It++;
+            break;
         }
+
+        PlaceTimer(Index, m_Timers[Parent]);
+        Index = Parent;
     }
+
+    PlaceTimer(Index, Handle);
+}
+
+void Window::SiftTimerDown(size_t Index)
+{
+    const TimerHandle Handle = m_Timers[Index];
+    const size_t Count = m_Timers.size();
+    while (true)
+    {
+        size_t Child = Index * 2 + 1;
+        if (Child >= Count)
+        {
+            break;
+        }
+
+        if (Child + 1 < Count && IsTimerBefore(m_Timers[Child + 1].Deadline, m_Timers[Child + 1].Sequence, m_Timers[Child].Deadline, m_Timers[Child].Sequence))
+        {
+            Child++;
+        }
+
+        if (!IsTimerBefore(m_Timers[Child].Deadline, m_Timers[Child].Sequence, Handle.Deadline, Handle.Sequence))
+        {
+            break;
+        }
+
+        PlaceTimer(Index, m_Timers[Child]);
+        Index = Child;
+    }
+
+    PlaceTimer(Index, Handle);
+}
+
+void Window::PlaceTimer(size_t Index, const TimerHandle& Handle)
+{
+    m_Timers[Index] = Handle;
+    Handle.Target->m_ScheduleIndex = Index;
 }
 
 void Window::UpdateFocus(const std::shared_ptr<Control>& Focus)
@@ -31,6 +31,8 @@ SOFTWARE.
 #include "Mouse.h"
 #include "Popup.h"
 #include "Rect.h"
+#include "ScratchArena.h"
+#include "VertexBuffer.h"
 
 #include <functional>
 #include <memory>
@@ -76,7 +78,7 @@ enum Flags
 class Window
 {
 public:
-    typedef std::function<void(Window*, const VertexBuffer&)> OnPaintSignature;
+    typedef std::function<void(Window*, const VertexBuffer&, const std::vector<Rect>&)> OnPaintSignature;
     typedef std::function<void(Window&, const char32_t*)> OnSetTitleSignature;
     typedef std::function<void(Window&)> OnWindowSignature;
 
@@ -191,10 +193,94 @@ public:
     Mouse::Cursor MouseCursor() const;
     Window& SetMousePosition(const Vector2& Position);
 
-    void Update();
-    void DoPaint(Paint& Brush);
+    /// @brief Updates timers and processes any pending layout requests.
+    ///
+    /// @param Budget Time in milliseconds available for layout. Requests that do not fit
+    /// are kept for the next update, although at least one request is always processed.
+    /// A negative budget processes every request.
+    void Update(float Budget = -1.0f);
+
+    /// @brief Builds the vertex buffer with BuildPaint and submits it with SubmitPaint.
+    void DoPaint();
+
+    /// @brief Paints all controls into the window's vertex buffer without submitting it.
+    ///
+    /// No frontend callbacks are invoked, so this may run on a worker thread as long as
+    /// nothing else accesses this window until it completes.
+    ///
+    /// @return True if the window needed to be repainted.
+    bool BuildPaint();
+
+    /// @brief Gives the buffer built by BuildPaint to the OnPaint callback. This must be
+    /// called on the main thread.
+    void SubmitPaint();
+    bool NeedsRepaint() const;
+
+    /// @brief Whether the window has layout requests or a repaint waiting to be processed.
+    bool NeedsUpdate() const;
+
+    /// @brief Arena for temporaries used while laying out this window's controls. It is reset
+    /// at the start of every update that processes layout requests, so allocations must not
+    /// be kept past a layout.
+    ScratchArena& Scratch();
+
+    /// @brief Keeps track of the oldest input event that has not been presented by a paint.
+    /// @param Timestamp Time the input was received in Clock::Timestamp microseconds.
+    void TrackInput(int64_t Timestamp);
+
+    /// @brief Time stamp of the oldest input received since the last submitted paint, or 0
+    /// if there is none.
+    int64_t OldestUnpaintedInput() const;
+    void ClearUnpaintedInput();
+
+    /// @brief Statistics for the vertex buffer this window paints into. The buffer is kept
+    /// between frames so a steady-state frame does not need to grow it.
+    VertexBuffer::Statistics PaintStatistics() const;
+
+    /// @brief Sets whether the vertex buffer given to the OnPaint callback is packed into the
+    /// compact layout. Frontends must read the buffer through its VertexLayout to support this.
+    ///
+    /// @param CompactVertices Boolean to enable compact vertices.
+    /// @return This reference for chaining.
+    Window& SetCompactVertices(bool CompactVertices);
+    bool CompactVertices() const;
+
+    /// @brief Sets whether shapes are given to the OnPaint callback as primitive instances.
+    ///
+    /// This should only be enabled by frontends that can draw VertexBuffer primitives.
+    /// Otherwise, shapes are tessellated into triangles.
+    ///
+    /// @param PrimitiveRendering Boolean to enable primitive rendering.
+    /// @return This reference for chaining.
+    Window& SetPrimitiveRendering(bool PrimitiveRendering);
+    bool PrimitiveRendering() const;
+
+    /// @brief Requests the entire window to be repainted.
     void Repaint();
 
+    /// @brief Requests the given region of the window to be repainted.
+    ///
+    /// Overlapping regions are merged. The accumulated regions are given to the
+    /// OnPaint callback on the next paint.
+    ///
+    /// @param Bounds The absolute bounds of the region that changed.
+    /// @return This reference for chaining.
+    Window& AddDamage(const Rect& Bounds);
+
+    /// @brief Sets whether only controls within the damaged regions are painted.
+    ///
+    /// This should only be enabled by frontends that preserve the contents of the
+    /// previous frame outside of the damaged regions.
+    ///
+    /// @param PartialRepaint Boolean to enable partial repaints.
+    /// @return This reference for chaining.
+    Window& SetPartialRepaint(bool PartialRepaint);
+    bool PartialRepaint() const;
+
+    /// @brief Returns a value that changes whenever all cached control geometry
+    /// becomes invalid, such as when the theme or render scale changes.
+    uint32_t PaintGeneration() const;
+
     void Load(const char* JsonStream);
     void Load(const char* JsonStream, ControlList& List);
     void Load(const Json& Root);
@@ -208,6 +294,10 @@ public:
     void StartTimer(const std::shared_ptr<Timer>& Object);
     bool ClearTimer(const std::shared_ptr<Timer>& Object);
 
+    /// @brief Number of milliseconds until the earliest running timer expires.
+    /// @return The remaining time, 0 if a timer is due, or -1 if no timers are running.
+    int NextTimerDeadline() const;
+
     Window& SetOnPaint(OnPaintSignature&& Fn);
     Window& SetOnSetTitle(OnSetTitleSignature&& Fn);
     Window& SetOnSetPosition(OnWindowSignature&& Fn);
@@ -219,28 +309,40 @@ public:
     Window& SetOnFocus(OnWindowSignature&& Fn);
 
 private:
+    friend class Timer;
+
+    // Entry in the timer schedule, which is a binary min-heap ordered by deadline. Each
+    // scheduled timer stores its index into the heap so it can be cancelled without a search.
     struct TimerHandle
     {
     public:
-        TimerHandle(const std::weak_ptr<Timer>& InObject)
-            : Object(InObject)
-        {
-        }
-
-        std::weak_ptr<Timer> Object;
-        Clock Elapsed {};
+        Timer* Target { nullptr };
+        int64_t Deadline { 0 };
+        uint64_t Sequence { 0 };
     };
 
     Window();
 
     void Populate(ControlList& List) const;
+    void OnInvalidate(const std::shared_ptr<Control>& Focus, InvalidateType Type);
     void RequestLayout(std::shared_ptr<Container> Request);
+    bool IsLayoutRequested(const Control* Item, uint32_t Generation) const;
     void UpdateTimers();
+    void ScheduleTimer(Timer* Object, int64_t Deadline);
+    void RemoveTimer(size_t Index);
+    void SiftTimerUp(size_t Index);
+    void SiftTimerDown(size_t Index);
+    void PlaceTimer(size_t Index, const TimerHandle& Handle);
     void UpdateFocus(const std::shared_ptr<Control>& Focus);
 
     Application* m_Application { nullptr };
     std::u32string m_Title {};
     std::string m_ID {};
+#if TOOLS
+    // Profiler labels are built when the title changes so that updates do not allocate.
+    std::string m_UpdateLabel { "Window::Update ()" };
+    std::string m_PaintLabel { "Window::OnPaint ()" };
+#endif
     Vector2 m_MousePosition {};
     Mouse::Cursor m_MouseCursor { Mouse::Cursor::Arrow };
     Rect m_Bounds {};
@@ -249,6 +351,15 @@ private:
     Vector2 m_RenderScale { 1.0f, 1.0f };
     std::shared_ptr<WindowContainer> m_Container { nullptr };
     bool m_Repaint { false };
+    bool m_RepaintAll { false };
+    bool m_PartialRepaint { false };
+    std::vector<Rect> m_Damage {};
+    std::unique_ptr<Paint> m_Brush { nullptr };
+    bool m_PaintBuilt { false };
+    int64_t m_UnpaintedInput { 0 };
+    bool m_CompactVertices { false };
+    bool m_PrimitiveRendering { false };
+    uint32_t m_PaintGeneration { 0 };
     std::weak_ptr<Control> m_Focus {};
     std::weak_ptr<Control> m_Hovered {};
     Popup m_Popup {};
@@ -256,8 +367,16 @@ private:
     bool m_RequestClose { false };
     uint64_t m_Flags { WindowFlags::Normal };
     std::vector<std::weak_ptr<Container>> m_LayoutRequests;
+    std::vector<std::weak_ptr<Container>> m_PendingLayouts {};
+    // Containers marked with the current generation have a pending layout request.
+    uint32_t m_LayoutGeneration { 1 };
+    ScratchArena m_Scratch {};
 
     std::vector<TimerHandle> m_Timers {};
+    std::vector<std::weak_ptr<Timer>> m_DueTimers {};
+    std::vector<std::weak_ptr<Timer>> m_CreatedTimers {};
+    Clock m_TimerClock {};
+    uint64_t m_TimerSequence { 0 };
 
     OnPaintSignature m_OnPaint { nullptr };
     OnContainerSignature m_OnPopupClose { nullptr };